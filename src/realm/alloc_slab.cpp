@@ -661,12 +661,16 @@ bool SlabAlloc::is_file_on_streaming_form(const Header& header)
 
 ref_type SlabAlloc::get_top_ref(const char* buffer, size_t len)
 {
-    // LIMITATION: Only come here if we've already had a read barrier for the affected part of the file
     const Header& header = reinterpret_cast<const Header&>(*buffer);
+    return get_top_ref(header, reinterpret_cast<const StreamingFooter*>(buffer + len) - 1);
+}
+
+ref_type SlabAlloc::get_top_ref(const Header& header, const StreamingFooter* footer)
+{
+    // LIMITATION: Only come here if we've already had a read barrier for the affected part of the file
     int slot_selector = ((header.m_flags & SlabAlloc::flags_SelectBit) != 0 ? 1 : 0);
     if (is_file_on_streaming_form(header)) {
-        const StreamingFooter& footer = *(reinterpret_cast<const StreamingFooter*>(buffer + len) - 1);
-        return ref_type(footer.m_top_ref);
+        return ref_type(footer->m_top_ref);
     }
     else {
         return to_ref(header.m_top_ref[slot_selector]);
@@ -760,16 +764,30 @@ ref_type SlabAlloc::attach_file(const std::string& file_path, Config& cfg)
     }
     ref_type top_ref;
     File::Map<char> initial_mapping;
+    File::Map<char> footer_mapping;
+    const StreamingFooter* footer = nullptr;
     try {
-        File::Map<char> map(m_file, File::access_ReadOnly, size); // Throws
+        // Only the header, and for a file on streaming form the footer, is
+        // needed to validate the file. Mapping just those keeps the cost of
+        // opening a file independent of its size.
+        File::Map<char> map(m_file, File::access_ReadOnly, std::min(size, sizeof(Header))); // Throws
         note_reader_start(this);
-        // we'll read header and (potentially) footer
-        realm::util::encryption_read_barrier(map, 0, sizeof(Header));
-        realm::util::encryption_read_barrier(map, size - sizeof(Header), sizeof(Header));
+        realm::util::encryption_read_barrier(map, 0, std::min(size, sizeof(Header)));
+        const Header* header = reinterpret_cast<const Header*>(map.get_addr());
+
+        if (size >= sizeof(Header) + sizeof(StreamingFooter) && is_file_on_streaming_form(*header)) {
+            size_t footer_pos = size - sizeof(StreamingFooter);
+            size_t footer_map_offset = footer_pos - footer_pos % page_size();
+            File::Map<char> fmap(m_file, footer_map_offset, File::access_ReadOnly,
+                                 size - footer_map_offset); // Throws
+            realm::util::encryption_read_barrier(fmap, footer_pos - footer_map_offset, sizeof(StreamingFooter));
+            footer = reinterpret_cast<const StreamingFooter*>(fmap.get_addr() + (footer_pos - footer_map_offset));
+            footer_mapping = std::move(fmap);
+        }
 
-        validate_header(map.get_addr(), size, path); // Throws
+        validate_header(header, footer, size, path); // Throws
 
-        top_ref = get_top_ref(map.get_addr(), size);
+        top_ref = get_top_ref(*header, footer);
 
         m_data = map.get_addr();
         initial_mapping = std::move(map); // replace at end of function
@@ -806,7 +824,7 @@ ref_type SlabAlloc::attach_file(const std::string& file_path, Config& cfg)
     // will need to change it either.
     const Header& header = *reinterpret_cast<const Header*>(m_data);
     if (cfg.session_initiator && is_file_on_streaming_form(header) && !cfg.read_only) {
-        const StreamingFooter& footer = *(reinterpret_cast<const StreamingFooter*>(m_data + size) - 1);
+        REALM_ASSERT(footer);
         // Don't compare file format version fields as they are allowed to differ.
         // Also don't compare reserved fields (todo, is it correct to ignore?)
         static_cast<void>(header);
@@ -818,12 +836,12 @@ ref_type SlabAlloc::attach_file(const std::string& file_path, Config& cfg)
         REALM_ASSERT_EX(header.m_top_ref[0] == 0xFFFFFFFFFFFFFFFFULL, header.m_top_ref[0], get_file_path_for_assertions());
         REALM_ASSERT_EX(header.m_top_ref[1] == 0, header.m_top_ref[1], get_file_path_for_assertions());
 
-        REALM_ASSERT_EX(footer.m_magic_cookie == footer_magic_cookie, footer.m_magic_cookie, get_file_path_for_assertions());
+        REALM_ASSERT_EX(footer->m_magic_cookie == footer_magic_cookie, footer->m_magic_cookie, get_file_path_for_assertions());
         {
             File::Map<Header> writable_map(m_file, File::access_ReadWrite, sizeof(Header)); // Throws
             Header& writable_header = *writable_map.get_addr();
             realm::util::encryption_read_barrier(writable_map, 0);
-            writable_header.m_top_ref[1] = footer.m_top_ref;
+            writable_header.m_top_ref[1] = footer->m_top_ref;
             writable_header.m_file_format[1] = writable_header.m_file_format[0];
             realm::util::encryption_write_barrier(writable_map, 0);
             writable_map.sync();
@@ -837,6 +855,7 @@ ref_type SlabAlloc::attach_file(const std::string& file_path, Config& cfg)
     }
     int file_format_version = get_committed_file_format_version();
     initial_mapping.unmap();
+    footer_mapping.unmap();
     m_data = nullptr;
 
     // We can only safely mmap the file, if its size matches a page boundary. If not,
@@ -1015,7 +1034,17 @@ void SlabAlloc::throw_header_exception(std::string msg, const Header& header, co
 
 void SlabAlloc::validate_header(const char* data, size_t size, const std::string& path)
 {
-    const Header& header = *reinterpret_cast<const Header*>(data);
+    const Header* header = reinterpret_cast<const Header*>(data);
+    const StreamingFooter* footer = nullptr;
+    if (size >= sizeof(Header) + sizeof(StreamingFooter))
+        footer = reinterpret_cast<const StreamingFooter*>(data + size) - 1;
+    validate_header(header, footer, size, path); // Throws
+}
+
+void SlabAlloc::validate_header(const Header* header_ptr, const StreamingFooter* footer_ptr, size_t size,
+                                const std::string& path)
+{
+    const Header& header = *header_ptr;
 
     // Verify that size is sane and 8-byte aligned
     if (REALM_UNLIKELY(size < sizeof(Header) || size % 8 != 0)) {
@@ -1038,7 +1067,7 @@ void SlabAlloc::validate_header(const char* data, size_t size, const std::string
             std::string msg = "Invalid streaming format size (" + util::to_string(size) + ")";
             throw InvalidDatabase(msg, path);
         }
-        const StreamingFooter& footer = *(reinterpret_cast<const StreamingFooter*>(data + size) - 1);
+        const StreamingFooter& footer = *footer_ptr;
         top_ref = footer.m_top_ref;
         if (REALM_UNLIKELY(footer.m_magic_cookie != footer_magic_cookie)) {
             std::string msg = "Invalid streaming format cookie (" + util::to_string(footer.m_magic_cookie) + ")";
@@ -657,12 +657,18 @@ private:
     /// corrupted, or if the specified encryption key is incorrect. This
     /// function will not detect all forms of corruption, though.
     void validate_header(const char* data, size_t len, const std::string& path);
+    /// As above, but with the header and the end of the file accessed through
+    /// separate pointers. \a footer is only read if the file is on streaming
+    /// form, and may be null otherwise.
+    void validate_header(const Header* header, const StreamingFooter* footer, size_t len,
+                         const std::string& path);
     void throw_header_exception(std::string msg, const Header& header, const std::string& path);
 
     static bool is_file_on_streaming_form(const Header& header);
     /// Read the top_ref from the given buffer and set m_file_on_streaming_form
     /// if the buffer contains a file in streaming form
     static ref_type get_top_ref(const char* data, size_t len);
+    static ref_type get_top_ref(const Header& header, const StreamingFooter* footer);
 
     // Gets the path of the attached file, or other relevant debugging info.
     std::string get_file_path_for_assertions() const;
@@ -130,6 +130,52 @@ bool ArrayBacklink::remove(size_t ndx, ObjKey key)
     return false;
 }
 
+// Return true if the last link was removed
+bool ArrayBacklink::remove(size_t ndx, ObjKey key, size_t count)
+{
+    if (count == 1)
+        return remove(ndx, key);
+
+    // More than one backlink from the same origin means that we have a list
+    uint64_t value = Array::get(ndx);
+    REALM_ASSERT(value != 0 && (value & 1) == 0);
+
+    Array backlink_list(m_alloc);
+    backlink_list.init_from_ref(ref_type(value));
+    backlink_list.set_parent(this, ndx);
+
+    // Squeeze out the matching entries, moving each remaining entry at most once
+    size_t sz = backlink_list.size();
+    size_t dst = backlink_list.find_first(key.value);
+    REALM_ASSERT_3(dst, !=, not_found);
+    size_t removed = 0;
+    for (size_t i = dst; i < sz; i++) {
+        int64_t v = backlink_list.get(i);
+        if (removed < count && v == key.value) {
+            removed++;
+            continue;
+        }
+        if (dst != i)
+            backlink_list.set(dst, v);
+        dst++;
+    }
+    REALM_ASSERT_3(removed, ==, count);
+
+    if (dst == 0) {
+        backlink_list.destroy();
+        set(ndx, 0);
+        return true;
+    }
+    if (dst == 1) {
+        uint64_t key_value = backlink_list.get(0);
+        backlink_list.destroy();
+        set(ndx, key_value << 1 | 1);
+        return false;
+    }
+    backlink_list.truncate(dst); // Throws
+    return false;
+}
+
 void ArrayBacklink::erase(size_t ndx)
 {
     uint64_t value = Array::get(ndx);
@@ -68,6 +68,8 @@ public:
     void nullify_fwd_links(size_t ndx, CascadeState& state);
     void add(size_t ndx, ObjKey key);
     bool remove(size_t ndx, ObjKey key);
+    // remove 'count' backlinks from 'key' in a single pass
+    bool remove(size_t ndx, ObjKey key, size_t count);
     void erase(size_t ndx);
     size_t get_backlink_count(size_t ndx) const;
     ObjKey get_backlink(size_t ndx, size_t index) const;
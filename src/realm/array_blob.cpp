@@ -84,8 +84,8 @@ ref_type Array::blob_replace(size_t begin, size_t end, const char* data, size_t
         size_t space_left = ArrayBlob::max_binary_size - lastNode.size();
         size_t size_to_copy = std::min(space_left, data_size);
         lastNode.add(data, size_to_copy);
-        data_size -= space_left;
-        data += space_left;
+        data_size -= size_to_copy;
+        data += size_to_copy;
 
         while (data_size) {
             // Create new nodes as required
@@ -104,6 +104,34 @@ ref_type Array::blob_replace(size_t begin, size_t end, const char* data, size_t
         return get_ref();
     }
     else if (begin == 0 && end == sz) {
+        if (!add_zero_term && data_size > ArrayBlob::max_binary_size) {
+            // Replace chunk by chunk. Chunks that are unchanged and already
+            // committed are left untouched, so they remain shared with the
+            // previous versions, and only the modified chunks are copied.
+            copy_on_write(); // Throws
+            size_t num_chunks = 0;
+            while (data_size) {
+                size_t chunk_size = std::min(size_t(ArrayBlob::max_binary_size), data_size);
+                if (num_chunks < size()) {
+                    ArrayBlob chunk(m_alloc);
+                    chunk.init_from_ref(get_as_ref(num_chunks));
+                    chunk.set_parent(this, num_chunks);
+                    chunk.replace(0, chunk.size(), data, chunk_size); // Throws
+                }
+                else {
+                    ArrayBlob new_blob(m_alloc);
+                    new_blob.create(); // Throws
+
+                    ref_type ref = new_blob.add(data, chunk_size); // Throws
+                    add(ref);                                      // Throws
+                }
+                data_size -= chunk_size;
+                data += chunk_size;
+                ++num_chunks;
+            }
+            truncate_and_destroy_children(num_chunks);
+            return get_ref();
+        }
         // Replace all. Start from scratch
         destroy_deep();
         ArrayBlob new_blob(m_alloc);
@@ -78,13 +78,14 @@ public:
         Array::insert(ndx, value);
     }
 
+    template <class cond = Equal>
     size_t find_first(util::Optional<bool> value, size_t begin = 0, size_t end = npos) const noexcept
     {
         if (value) {
-            return Array::find_first(*value, begin, end);
+            return Array::find_first<cond>(*value, begin, end);
         }
         else {
-            return Array::find_first(null_value, begin, end);
+            return Array::find_first<cond>(null_value, begin, end);
         }
     }
 
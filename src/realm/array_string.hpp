@@ -107,6 +107,16 @@ public:
 
     size_t find_first(StringData value, size_t begin, size_t end) const noexcept;
 
+    /// Find the first element in [begin, end) for which `pred(StringData)`
+    /// returns true. The leaf representation is resolved once for the range,
+    /// so the predicate is applied in a loop over the underlying array
+    /// rather than going through get() for every element.
+    template <class Pred>
+    size_t find_first_if(Pred&& pred, size_t begin, size_t end) const;
+
+    /// Find the first string in [begin, end) that starts with `prefix`.
+    size_t find_first_prefix(StringData prefix, size_t begin, size_t end) const;
+
     size_t lower_bound(StringData value);
 
     /// Get the specified element without the cost of constructing an
@@ -159,6 +169,62 @@ inline StringData ArrayString::get(const char* header, size_t ndx, Allocator& al
     }
 }
 
+template <class Pred>
+size_t ArrayString::find_first_if(Pred&& pred, size_t begin, size_t end) const
+{
+    switch (m_type) {
+        case Type::small_strings: {
+            auto arr = static_cast<const ArrayStringShort*>(m_arr);
+            for (size_t i = begin; i < end; ++i) {
+                if (pred(arr->get(i)))
+                    return i;
+            }
+            break;
+        }
+        case Type::medium_strings: {
+            auto arr = static_cast<const ArraySmallBlobs*>(m_arr);
+            for (size_t i = begin; i < end; ++i) {
+                if (pred(arr->get_string(i)))
+                    return i;
+            }
+            break;
+        }
+        case Type::big_strings: {
+            auto arr = static_cast<const ArrayBigBlobs*>(m_arr);
+            for (size_t i = begin; i < end; ++i) {
+                if (pred(arr->get_string(i)))
+                    return i;
+            }
+            break;
+        }
+        case Type::enum_strings: {
+            // Consecutive elements often share the same enum value, so only
+            // evaluate the predicate when the value index changes.
+            auto arr = static_cast<const ArrayInteger*>(m_arr);
+            int64_t last_index = -1;
+            bool last_match = false;
+            for (size_t i = begin; i < end; ++i) {
+                int64_t index = arr->get(i);
+                if (index != last_index) {
+                    last_index = index;
+                    last_match = pred(m_string_enum_values->get(size_t(index)));
+                }
+                if (last_match)
+                    return i;
+            }
+            break;
+        }
+    }
+    return not_found;
+}
+
+inline size_t ArrayString::find_first_prefix(StringData prefix, size_t begin, size_t end) const
+{
+    if (m_type == Type::small_strings)
+        return static_cast<const ArrayStringShort*>(m_arr)->find_first_prefix(prefix, begin, end);
+    return find_first_if([&](StringData str) { return str.begins_with(prefix); }, begin, end);
+}
+
 template <>
 class QueryState<StringData> : public QueryStateBase {
 public:
@@ -258,17 +258,113 @@ size_t ArrayStringShort::find_first(StringData value, size_t begin, size_t end)
         }
     }
     else {
+        return find_first_bytes(value, true, begin, end);
+    }
+
+    return not_found;
+}
+
+size_t ArrayStringShort::find_first_prefix(StringData prefix, size_t begin, size_t end) const noexcept
+{
+    if (end == size_t(-1))
+        end = m_size;
+    REALM_ASSERT(begin <= m_size && end <= m_size && begin <= end);
+
+    const size_t prefix_size = prefix.size();
+    if (prefix_size == 0) {
+        // Every string starts with null, and every string except null starts with ""
+        if (prefix.is_null() || !m_nullable)
+            return begin < end ? begin : not_found;
         for (size_t i = begin; i != end; ++i) {
-            const char* data = m_data + (i * m_width);
-            if (memcmp(data, value.data(), value_size) == 0) {
-                size_t data_size = (m_width - 1) - data[m_width - 1];
-                if (data_size == value_size) {
-                    return i;
-                }
+            if (!is_null(i))
+                return i;
+        }
+        return not_found;
+    }
+
+    // A string can never be wider than the column width
+    if (m_width <= prefix_size)
+        return not_found;
+
+    return find_first_bytes(prefix, false, begin, end);
+}
+
+// All slots are zero padded and share the same width, so the leading bytes of
+// every slot can be compared against one padded copy of the needle a word (or
+// an SSE register) at a time. Only slots whose first needle.size() bytes match
+// have their length checked: equal to the needle if `exact`, otherwise at least
+// as long as it.
+size_t ArrayStringShort::find_first_bytes(StringData needle, bool exact, size_t begin, size_t end) const noexcept
+{
+    const size_t width = m_width;
+    const size_t needle_size = needle.size();
+    REALM_ASSERT_DEBUG(0 < needle_size && needle_size < width);
+
+    auto length_matches = [&](const char* slot) {
+        // A null string has the last byte set to the width, which gives a size of -1
+        int slot_size = int(width) - 1 - int(slot[width - 1]);
+        return exact ? slot_size == int(needle_size) : slot_size >= int(needle_size);
+    };
+
+    if (width < 8) {
+        for (size_t i = begin; i != end; ++i) {
+            const char* slot = m_data + (i * width);
+            if (memcmp(slot, needle.data(), needle_size) == 0 && length_matches(slot))
+                return i;
+        }
+        return not_found;
+    }
+
+    // The needle padded to the slot width, and a mask selecting the bytes to compare
+    alignas(16) char padded[max_width] = {};
+    alignas(16) char mask[max_width] = {};
+    realm::safe_copy_n(needle.data(), needle_size, padded);
+    std::fill(mask, mask + needle_size, char(0xff));
+
+#ifdef REALM_COMPILER_SSE
+    if (width >= 16) {
+        const size_t num_chunks = (needle_size + 15) / 16;
+        __m128i needle_chunks[max_width / 16];
+        int mask_bits[max_width / 16];
+        for (size_t c = 0; c < num_chunks; ++c) {
+            needle_chunks[c] = _mm_load_si128(reinterpret_cast<const __m128i*>(padded + c * 16));
+            mask_bits[c] = _mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(mask + c * 16)));
+        }
+        for (size_t i = begin; i != end; ++i) {
+            const char* slot = m_data + (i * width);
+            size_t c = 0;
+            for (; c < num_chunks; ++c) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(slot + c * 16));
+                int equal_bits = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle_chunks[c]));
+                if ((equal_bits & mask_bits[c]) != mask_bits[c])
+                    break;
             }
+            if (c == num_chunks && length_matches(slot))
+                return i;
         }
+        return not_found;
     }
+#endif
 
+    const size_t num_words = (needle_size + 7) / 8;
+    uint64_t needle_words[max_width / 8];
+    uint64_t mask_words[max_width / 8];
+    for (size_t w = 0; w < num_words; ++w) {
+        memcpy(&needle_words[w], padded + w * 8, 8);
+        memcpy(&mask_words[w], mask + w * 8, 8);
+    }
+    for (size_t i = begin; i != end; ++i) {
+        const char* slot = m_data + (i * width);
+        size_t w = 0;
+        for (; w < num_words; ++w) {
+            uint64_t word;
+            memcpy(&word, slot + w * 8, 8);
+            if (((word ^ needle_words[w]) & mask_words[w]) != 0)
+                break;
+        }
+        if (w == num_words && length_matches(slot))
+            return i;
+    }
     return not_found;
 }
 
@@ -62,6 +62,8 @@ public:
 
     size_t count(StringData value, size_t begin = 0, size_t end = npos) const noexcept;
     size_t find_first(StringData value, size_t begin = 0, size_t end = npos) const noexcept;
+    /// Find the first string in [begin, end) that starts with `prefix`.
+    size_t find_first_prefix(StringData prefix, size_t begin = 0, size_t end = npos) const noexcept;
     void find_all(IntegerColumn& result, StringData value, size_t add_offset = 0, size_t begin = 0,
                   size_t end = npos);
 
@@ -95,6 +97,7 @@ public:
 private:
     size_t calc_byte_len(size_t num_items, size_t width) const override;
     size_t calc_item_count(size_t bytes, size_t width) const noexcept override;
+    size_t find_first_bytes(StringData needle, bool exact, size_t begin, size_t end) const noexcept;
 
     bool m_nullable;
 };
@@ -195,6 +195,39 @@ size_t ArrayTimestamp::find_first<LessEqual>(Timestamp value, size_t begin, size
     return not_found;
 }
 
+size_t ArrayTimestamp::find_first_between(Timestamp from, Timestamp to, size_t begin, size_t end) const noexcept
+{
+    REALM_ASSERT_DEBUG(!from.is_null() && !to.is_null());
+    if (to < from) {
+        return not_found;
+    }
+    int64_t from_sec = from.get_seconds();
+    int64_t to_sec = to.get_seconds();
+    while (begin < end) {
+        // Let the seconds array skip everything below the lower bound. This also skips nulls.
+        size_t ret = m_seconds.find_first<GreaterEqual>(from_sec, begin, end);
+
+        if (ret == not_found)
+            return not_found;
+
+        int64_t sec = *m_seconds.get(ret);
+        if (sec > from_sec && sec < to_sec) {
+            return ret;
+        }
+        if (sec <= to_sec) {
+            // The value is on one of the boundary seconds, so the nanoseconds decide
+            int32_t nanos = int32_t(m_nanoseconds.get(ret));
+            if ((sec > from_sec || nanos >= from.get_nanoseconds()) &&
+                (sec < to_sec || nanos <= to.get_nanoseconds())) {
+                return ret;
+            }
+        }
+        begin = ret + 1;
+    }
+
+    return not_found;
+}
+
 template <>
 size_t ArrayTimestamp::find_first<Equal>(Timestamp value, size_t begin, size_t end) const noexcept
 {
@@ -102,6 +102,9 @@ public:
 
     size_t find_first(Timestamp value, size_t begin, size_t end) const noexcept;
 
+    // Find first value in the closed range [from, to]. Neither bound may be null.
+    size_t find_first_between(Timestamp from, Timestamp to, size_t begin, size_t end) const noexcept;
+
     void verify() const;
 
 private:
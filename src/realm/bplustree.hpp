@@ -457,6 +457,27 @@ public:
         m_root->bptree_access(n, func);
     }
 
+    // Overwrite the first 'n' elements with 'value_at(0)' ... 'value_at(n - 1)'.
+    // Each leaf is visited once, so no nodes are allocated or rebalanced.
+    template <typename Func>
+    void set_range(size_t n, Func&& value_at)
+    {
+        REALM_ASSERT(n <= m_size);
+        if (n == 0)
+            return;
+
+        auto func = [n, &value_at](BPlusTreeNode* node, size_t offset) {
+            LeafNode* leaf = static_cast<LeafNode*>(node);
+            size_t sz = std::min(leaf->size(), n - offset);
+            for (size_t i = 0; i < sz; i++) {
+                leaf->set(i, value_at(offset + i));
+            }
+            return offset + sz >= n;
+        };
+
+        m_root->bptree_traverse(func);
+    }
+
     void swap(size_t ndx1, size_t ndx2)
     {
         // We need two buffers. It is illegal to call set() with get() as argument
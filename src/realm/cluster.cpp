@@ -95,6 +95,10 @@ public:
     {
         return size_t(Array::get(s_sub_tree_size)) >> 1;
     }
+    static size_t get_tree_size_from_header(const char* header)
+    {
+        return size_t(Array::get(header, s_sub_tree_size)) >> 1;
+    }
     void set_tree_size(size_t sub_tree_size)
     {
         Array::set(s_sub_tree_size, sub_tree_size << 1 | 1);
@@ -430,7 +434,7 @@ size_t ClusterNodeInner::get_ndx(ObjKey key, size_t ndx) const
     else {
         for (unsigned i = 0; i < child_info.ndx; i++) {
             char* header = m_alloc.translate(_get_child_ref(i));
-            ndx += size_t(Array::get(header, s_sub_tree_size)) >> 1;
+            ndx += get_tree_size_from_header(header);
         }
         ClusterNodeInner node(m_alloc, m_tree_top);
         node.init(child_info.mem);
@@ -680,7 +684,7 @@ size_t ClusterNodeInner::update_sub_tree_size()
             sub_tree_size += Cluster::node_size_from_header(m_alloc, header);
         }
         else {
-            sub_tree_size += size_t(Array::get(header, s_sub_tree_size)) >> 1;
+            sub_tree_size += get_tree_size_from_header(header);
         }
     }
     set_tree_size(sub_tree_size);
@@ -1133,23 +1137,80 @@ void Cluster::ensure_general_form()
     }
 }
 
+namespace {
+
+// Create a leaf holding 'sz' default values
 template <class T>
-inline void Cluster::do_insert_column(ColKey col_key, bool nullable)
+ref_type create_default_leaf(Allocator& alloc, size_t sz, bool nullable)
 {
-    size_t sz = node_size();
-
-    T arr(m_alloc);
+    T arr(alloc);
     arr.create();
     auto val = T::default_value(nullable);
     for (size_t i = 0; i < sz; i++) {
         arr.add(val);
     }
+    return arr.get_ref();
+}
+
+// The leaves below are created with all the default values in place in a
+// single allocation. For integer based leaves the default is represented by
+// zero, which requires no storage at all.
+
+template <>
+ref_type create_default_leaf<ArrayInteger>(Allocator& alloc, size_t sz, bool)
+{
+    return Array::create_array(Array::type_Normal, false, sz, 0, alloc).get_ref(); // Throws
+}
+
+template <>
+ref_type create_default_leaf<ArrayIntNull>(Allocator& alloc, size_t sz, bool nullable)
+{
+    REALM_ASSERT_DEBUG(nullable);
+    // All elements equal to the null value in the first slot
+    return ArrayIntNull::create_array(Array::type_Normal, false, sz, alloc).get_ref(); // Throws
+}
+
+template <>
+ref_type create_default_leaf<ArrayKey>(Allocator& alloc, size_t sz, bool)
+{
+    // Null keys are stored as zero
+    return Array::create_array(Array::type_Normal, false, sz, 0, alloc).get_ref(); // Throws
+}
+
+template <>
+ref_type create_default_leaf<ArrayBacklink>(Allocator& alloc, size_t sz, bool)
+{
+    return Array::create_array(Array::type_HasRefs, false, sz, 0, alloc).get_ref(); // Throws
+}
+
+template <>
+ref_type create_default_leaf<ArrayFloatNull>(Allocator& alloc, size_t sz, bool nullable)
+{
+    return ArrayFloatNull::create_array(Array::type_Normal, false, sz, ArrayFloatNull::default_value(nullable),
+                                        alloc)
+        .get_ref(); // Throws
+}
+
+template <>
+ref_type create_default_leaf<ArrayDoubleNull>(Allocator& alloc, size_t sz, bool nullable)
+{
+    return ArrayDoubleNull::create_array(Array::type_Normal, false, sz, ArrayDoubleNull::default_value(nullable),
+                                         alloc)
+        .get_ref(); // Throws
+}
+
+} // anonymous namespace
+
+template <class T>
+inline void Cluster::do_insert_column(ColKey col_key, bool nullable)
+{
+    ref_type ref = create_default_leaf<T>(m_alloc, node_size(), nullable); // Throws
     auto col_ndx = col_key.get_index();
     unsigned ndx = col_ndx.val + s_first_col_index;
     if (ndx == size())
-        Array::insert(ndx, from_ref(arr.get_ref()));
+        Array::insert(ndx, from_ref(ref));
     else
-        Array::set(ndx, from_ref(arr.get_ref()));
+        Array::set(ndx, from_ref(ref));
 }
 
 void Cluster::insert_column(ColKey col_key)
@@ -1744,10 +1805,39 @@ void Cluster::remove_backlinks(ObjKey origin_key, ColKey origin_col_key, const s
     ColKey backlink_col_key = origin_table->get_opposite_column(origin_col_key);
     bool strong_links = (origin_table->get_link_type(origin_col_key) == link_Strong);
 
-    for (auto key : keys) {
-        if (key != null_key) {
-            Obj target_obj = target_table->get_object(key);
-            bool last_removed = target_obj.remove_one_backlink(backlink_col_key, origin_key); // Throws
+    if (keys.size() < 2) {
+        for (auto key : keys) {
+            if (key != null_key) {
+                Obj target_obj = target_table->get_object(key);
+                bool last_removed = target_obj.remove_one_backlink(backlink_col_key, origin_key); // Throws
+                state.enqueue_for_cascade(target_obj, strong_links, last_removed);
+            }
+        }
+        return;
+    }
+
+    // A list may link to the same target many times. Remove all the backlinks
+    // to each target in one go, at the position of its last occurrence. This
+    // way objects are enqueued for cascade in the same order as if the
+    // backlinks were removed one by one.
+    std::vector<std::pair<ObjKey, size_t>> occurrences;
+    occurrences.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] != null_key)
+            occurrences.emplace_back(keys[i], i);
+    }
+    std::sort(occurrences.begin(), occurrences.end());
+    std::vector<size_t> counts(keys.size(), 0);
+    for (auto it = occurrences.begin(); it != occurrences.end();) {
+        auto end = std::find_if(it, occurrences.end(), [&](auto& o) { return o.first != it->first; });
+        counts[(end - 1)->second] = size_t(end - it);
+        it = end;
+    }
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (size_t count = counts[i]) {
+            Obj target_obj = target_table->get_object(keys[i]);
+            bool last_removed = target_obj.remove_backlinks(backlink_col_key, origin_key, count); // Throws
             state.enqueue_for_cascade(target_obj, strong_links, last_removed);
         }
     }
@@ -1976,6 +2066,32 @@ Obj ClusterTree::get(ObjKey k)
     return Obj(get_table_ref(), state.mem, k, state.index);
 }
 
+size_t ClusterTree::size_from_ref(ref_type ref, Allocator& alloc)
+{
+    if (!ref)
+        return 0;
+    const char* header = alloc.translate(ref);
+    if (Array::get_is_inner_bptree_node_from_header(header))
+        return ClusterNodeInner::get_tree_size_from_header(header);
+    return Cluster::node_size_from_header(alloc, header);
+}
+
+ConstObj ClusterTree::try_get(ObjKey k) const
+{
+    ClusterNode::State state;
+    if (!k || !m_root->try_get(k, state))
+        return {};
+    return ConstObj(get_table_ref(), state.mem, k, state.index);
+}
+
+Obj ClusterTree::try_get(ObjKey k)
+{
+    ClusterNode::State state;
+    if (!k || !m_root->try_get(k, state))
+        return {};
+    return Obj(get_table_ref(), state.mem, k, state.index);
+}
+
 ConstObj ClusterTree::get(size_t ndx) const
 {
     if (ndx >= m_size) {
@@ -33,6 +33,8 @@ public:
 
     ClusterTree(Table* owner, Allocator& alloc);
     static MemRef create_empty_cluster(Allocator& alloc);
+    // Get the number of objects in the tree without creating an accessor
+    static size_t size_from_ref(ref_type ref, Allocator& alloc);
 
     ClusterTree(ClusterTree&&) = default;
 
@@ -127,6 +129,10 @@ public:
     ConstObj get(ObjKey k) const;
     // Lookup and return object
     Obj get(ObjKey k);
+    // Lookup and return read-only object. Returns a default constructed object if not found
+    ConstObj try_get(ObjKey k) const;
+    // Lookup and return object. Returns a default constructed object if not found
+    Obj try_get(ObjKey k);
     // Lookup ContsObj by index
     ConstObj get(size_t ndx) const;
     // Lookup Obj by index
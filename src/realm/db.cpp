@@ -1473,6 +1473,31 @@ bool DB::compact(bool bump_version_number, util::Optional<const char*> output_en
     return true;
 }
 
+void DB::snapshot_to(const std::string& path)
+{
+    if (is_attached() == false) {
+        throw std::runtime_error(m_db_path + ": snapshot_to must be done on an open/attached DB");
+    }
+    SharedInfo* info = m_file_map.get_addr();
+    Durability dura = Durability(info->durability);
+    if (dura == Durability::MemOnly || dura == Durability::Async) {
+        // In these modes commits do not update the header of the file, so the
+        // file on disk does not hold the latest version. Write that version
+        // out from a read transaction instead. Group::write() requires that
+        // the target does not exist.
+        TransactionRef tr = start_read();
+        File::try_remove(path);
+        tr->write(path, m_key, tr->get_version_of_current_transaction().version); // Throws
+        return;
+    }
+    // Holding the write mutex keeps writers in all processes from touching the
+    // file while it is copied. Every commit has then completed, including the
+    // flip of the top ref selector in the header, so the copy opens at the
+    // latest committed version.
+    std::lock_guard<InterprocessMutex> lock(m_writemutex); // Throws
+    util::File::copy(m_db_path, path);                     // Throws
+}
+
 uint_fast64_t DB::get_number_of_versions()
 {
     SharedInfo* info = m_file_map.get_addr();
@@ -2282,6 +2307,57 @@ void DB::low_level_commit(uint_fast64_t new_version, Transaction& transaction)
     }
 }
 
+std::pair<ref_type, size_t> DB::low_level_spill(Transaction& transaction)
+{
+    SharedInfo* info = m_file_map.get_addr();
+
+    // The spilled arrays are tagged as if they were written by the next
+    // version. No snapshot will ever see them, so that is merely conservative.
+    uint_fast64_t oldest_version;
+    uint_fast64_t new_version;
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+        SharedInfo* r_info = m_reader_map.get_addr();
+        if (grow_reader_mapping(r_info->readers.get_num_entries() - 1)) { // throws
+            r_info = m_reader_map.get_addr();
+        }
+        r_info->readers.cleanup();
+        oldest_version = r_info->readers.get_oldest().version;
+        new_version = r_info->get_current_version_unchecked() + 1;
+
+        // The history is not trimmed here. The changeset of this transaction
+        // has not been added yet, and commit will trim it anyway.
+
+        // Cleanup any stale mappings, as the remap after the spill adds more
+        m_alloc.purge_old_mappings(oldest_version, new_version);
+    }
+
+    GroupWriter out(transaction, Durability(info->durability)); // Throws
+    out.set_versions(new_version, oldest_version);
+    ref_type new_top_ref;
+    {
+        // protect against race with any other DB trying to attach to the file
+        std::lock_guard<InterprocessMutex> lock(m_controlmutex); // Throws
+        new_top_ref = out.write_group();                         // Throws
+    }
+    // The windows holding the spilled arrays are gone by the time the commit
+    // syncs its own, so the data must reach the disk before the commit can
+    // publish a top ref pointing at it.
+    bool disable_sync = get_disable_sync_to_disk();
+    if (Durability(info->durability) == Durability::Full && !disable_sync)
+        out.sync_all_mappings(); // Throws
+    size_t new_file_size = out.get_file_size();
+    {
+        std::lock_guard<std::recursive_mutex> lock_guard(m_mutex);
+        m_free_space = out.get_free_space_size();
+        m_locked_space = out.get_locked_space_size();
+        m_used_space = new_file_size - m_free_space;
+        // Unlike a commit, the header and the ringbuffer are left untouched
+        reset_free_space_tracking();
+    }
+    return {new_top_ref, new_file_size};
+}
+
 #ifdef REALM_DEBUG
 void DB::reserve(size_t size)
 {
@@ -2524,6 +2600,25 @@ void Transaction::commit_and_continue_writing()
     remap_and_update_refs(m_read_lock.m_top_ref, m_read_lock.m_file_size, writable); // Throws
 }
 
+void Transaction::spill()
+{
+    if (!is_attached())
+        throw LogicError(LogicError::wrong_transact_state);
+    if (m_transact_stage != DB::transact_Writing)
+        throw LogicError(LogicError::wrong_transact_state);
+
+    // Allow any accessors at group level or below to sync, as before a commit
+    flush_accessors_for_commit();
+
+    auto spilled = db->low_level_spill(*this); // Throws
+
+    // Continue the transaction from the spilled state. m_read_lock still
+    // holds the snapshot the transaction started from, which keeps the
+    // space it uses from being reclaimed.
+    bool writable = true;
+    remap_and_update_refs(spilled.first, spilled.second, writable); // Throws
+}
+
 void Transaction::initialize_replication()
 {
     if (m_transact_stage == DB::transact_Writing) {
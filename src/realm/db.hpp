@@ -284,6 +284,23 @@ public:
     /// WARNING: Compact() is not thread-safe with respect to a concurrent close()
     bool compact(bool bump_version_number = false, util::Optional<const char*> output_encryption_key = util::none);
 
+    /// Copy the database file, as of the latest committed version, to the
+    /// specified path. An existing file at that path is overwritten. The write
+    /// lock is held while copying, so no commit can interleave, but readers are
+    /// not blocked. Where the file system supports it, the copy is a
+    /// copy-on-write clone (see util::File::copy()), so its cost does not grow
+    /// with the size of the file.
+    ///
+    /// Unlike compact(), the copy holds the file as is, including free space
+    /// and the current encryption. It must not be called by a thread that has
+    /// an open write transaction on this DB.
+    ///
+    /// With Durability::MemOnly and Durability::Async, the file on disk does
+    /// not hold the latest version. The copy is then written from a read
+    /// transaction using Group::write(), so it holds only live data, and its
+    /// cost grows with the size of the data.
+    void snapshot_to(const std::string& path);
+
 #ifdef REALM_DEBUG
     void test_ringbuf();
 #endif
@@ -506,6 +523,11 @@ private:
     // mutex.
     void low_level_commit(uint_fast64_t new_version, Transaction& transaction);
 
+    // Write all changes of the transaction to free space in the file without
+    // publishing them. Returns the new top ref and file size. Must be called
+    // only by someone that has a lock on the write mutex.
+    std::pair<ref_type, size_t> low_level_spill(Transaction& transaction);
+
     void do_async_commits();
 
     /// Upgrade file format and/or history schema
@@ -566,6 +588,14 @@ public:
     void rollback();
     void end_read();
 
+    /// Write the changes made so far in this write transaction to free space
+    /// in the file, and release the memory that held them. The changes stay
+    /// invisible to other transactions until commit(), and rollback() still
+    /// discards them. Use this to bound memory usage during bulk loads, for
+    /// example whenever get_commit_size() exceeds a budget. Accessors stay
+    /// valid.
+    void spill();
+
     // Live transactions state changes, often taking an observer functor:
     DB::version_type commit_and_continue_as_read();
     template <class O>
@@ -532,17 +532,21 @@ std::vector<Entry> get_nodes(realm::Allocator& alloc, uint64_t ref)
         }
         nodes.emplace_back(ref, arr.size_in_bytes());
         if (arr.has_refs()) {
+            // Collect the nodes of all children before consolidating, so that
+            // the list is only sorted once per array instead of once per child
+            std::vector<Entry> sub_nodes;
             auto sz = arr.size();
             path.push_back(0);
             for (unsigned i = 0; i < sz; i++) {
                 uint64_t r = arr.get_ref(i);
                 if (r) {
                     path.back() = i;
-                    auto sub_nodes = get_nodes(alloc, r);
-                    consolidate_lists(nodes, sub_nodes);
+                    auto child_nodes = get_nodes(alloc, r);
+                    sub_nodes.insert(sub_nodes.end(), child_nodes.begin(), child_nodes.end());
                 }
             }
             path.pop_back();
+            consolidate_lists(nodes, sub_nodes);
         }
     }
     return nodes;
@@ -17,6 +17,7 @@
  **************************************************************************/
 
 #include <new>
+#include <limits>
 #include <algorithm>
 #include <set>
 #include <fstream>
@@ -52,6 +53,75 @@ public:
 
 Initialization initialization;
 
+// Output buffer for Group::write_to_mem(). It starts out at the estimated size
+// of the output and is only reallocated if the estimate turns out to be short.
+class GrowableOutputStreambuf : public std::streambuf {
+public:
+    GrowableOutputStreambuf(size_t initial_capacity)
+    {
+        reserve(initial_capacity);
+    }
+
+    size_t size() const noexcept
+    {
+        return size_t(pptr() - pbase());
+    }
+
+    char* release() noexcept
+    {
+        return m_buffer.release();
+    }
+
+private:
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_capacity = 0;
+
+    void reserve(size_t min_capacity)
+    {
+        size_t used = size();
+        size_t new_capacity = std::max(min_capacity, m_capacity + m_capacity / 2);
+        std::unique_ptr<char[]> new_buffer(new (std::nothrow) char[new_capacity]);
+        if (!new_buffer)
+            throw util::bad_alloc();
+        std::copy_n(pbase(), used, new_buffer.get());
+        m_buffer = std::move(new_buffer);
+        m_capacity = new_capacity;
+        setp(m_buffer.get(), m_buffer.get() + new_capacity);
+        advance(used);
+    }
+
+    // pbump() takes an int, so large offsets must be applied in steps
+    void advance(size_t n)
+    {
+        constexpr size_t max_step = std::numeric_limits<int>::max();
+        while (n > max_step) {
+            pbump(int(max_step));
+            n -= max_step;
+        }
+        pbump(int(n));
+    }
+
+    int_type overflow(int_type ch) override
+    {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+        reserve(size() + 1);
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        return ch;
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize n) override
+    {
+        size_t size_n = size_t(n);
+        if (size_n > size_t(epptr() - pptr()))
+            reserve(size() + size_n);
+        std::copy_n(data, size_n, pptr());
+        advance(size_n);
+        return n;
+    }
+};
+
 } // anonymous namespace
 
 constexpr char Group::g_class_name_prefix[];
@@ -744,14 +814,17 @@ void Group::update_num_objects()
 {
 #if REALM_METRICS
     if (m_metrics) {
-        // FIXME: this is quite invasive and completely defeats the lazy loading mechanism
-        // where table accessors are only instantiated on demand, because they are all created here.
-
+        // The sizes are read directly from the cluster trees, so that table
+        // accessors are still only instantiated on demand.
         m_total_rows = 0;
-        auto keys = get_table_keys();
-        for (auto key : keys) {
-            ConstTableRef t = get_table(key);
-            m_total_rows += t->size();
+        if (m_tables.is_attached()) {
+            size_t num_tables = m_tables.size();
+            for (size_t j = 0; j < num_tables; ++j) {
+                RefOrTagged rot = m_tables.get_as_ref_or_tagged(j);
+                if (rot.is_ref() && rot.get_as_ref()) {
+                    m_total_rows += Table::get_size_direct(m_alloc, rot.get_as_ref());
+                }
+            }
         }
     }
 #endif // REALM_METRICS
@@ -1189,20 +1262,18 @@ BinaryData Group::write_to_mem() const
 {
     REALM_ASSERT(is_attached());
 
-    // Get max possible size of buffer
-    //
-    // FIXME: This size could potentially be vastly bigger that what
-    // is actually needed.
-    size_t max_size = m_alloc.get_total_size();
-
-    auto buffer = std::unique_ptr<char[]>(new (std::nothrow) char[max_size]);
-    if (!buffer)
-        throw util::bad_alloc();
-    MemoryOutputStream out; // Throws
-    out.set_buffer(buffer.get(), buffer.get() + max_size);
+    // The output holds the live part of the last committed state plus what
+    // has been allocated since. The total size of the allocator is an upper
+    // bound, but it includes all free space and can be vastly bigger.
+    size_t estimated_size = get_used_space() + m_alloc.get_commit_size() + page_size();
+    estimated_size = std::min(estimated_size, m_alloc.get_total_size() + page_size());
+
+    GrowableOutputStreambuf streambuf(estimated_size); // Throws
+    std::ostream out(&streambuf);
+    out.exceptions(std::ios_base::failbit | std::ios_base::badbit);
     write(out); // Throws
-    size_t buffer_size = out.size();
-    return BinaryData(buffer.release(), buffer_size);
+    size_t buffer_size = streambuf.size();
+    return BinaryData(streambuf.release(), buffer_size);
 }
 
 
@@ -1822,6 +1893,13 @@ public:
         REALM_ASSERT_3(size, >, 0);
         REALM_ASSERT_3(ref, >=, m_ref_begin);
         REALM_ASSERT(size <= (ref < m_baseline ? m_immutable_ref_end : m_mutable_ref_end) - ref);
+        // Arrays are mostly reported in the order they were written, so many
+        // chunks can be merged right away. This keeps the number of chunks to
+        // sort in canonicalize() down.
+        if (!m_chunks.empty() && m_chunks.back().ref + m_chunks.back().size == ref) {
+            m_chunks.back().size += size;
+            return;
+        }
         Chunk chunk;
         chunk.ref = ref;
         chunk.size = size;
@@ -17,6 +17,7 @@
  **************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 
 #ifdef REALM_DEBUG
 #include <iostream>
@@ -34,6 +35,10 @@ using namespace realm;
 using namespace realm::util;
 using namespace realm::metrics;
 
+namespace {
+std::atomic<size_t> num_window_syncs(0); // this is for statistical purposes
+} // anonymous namespace
+
 // Class controlling a memory mapped window into a file
 class GroupWriter::MapWindow {
 public:
@@ -51,7 +56,7 @@ public:
     bool matches(ref_type start_ref, size_t size);
     // return false if the mapping cannot be extended to hold the
     // requested size - extends if possible and then returns true
-    bool extends_to_match(util::File& f, ref_type start_ref, size_t size);
+    bool extends_to_match(util::File& f, ref_type start_ref, size_t size, bool sync_before_remap);
 
 private:
     util::File::Map<char> m_map;
@@ -107,14 +112,16 @@ size_t GroupWriter::MapWindow::get_window_size(util::File& f, ref_type start_ref
 //
 // extends_to_match() will extend an existing mapping to accomodate a new request if possible
 // and return true. If the request falls in a different 1MB window, it'll return false.
-bool GroupWriter::MapWindow::extends_to_match(util::File& f, ref_type start_ref, size_t size)
+bool GroupWriter::MapWindow::extends_to_match(util::File& f, ref_type start_ref, size_t size,
+                                              bool sync_before_remap)
 {
     size_t aligned_ref = aligned_to_mmap_block(start_ref);
     if (aligned_ref != m_base_ref)
         return false;
     size_t window_size = get_window_size(f, start_ref, size);
     // FIXME: Add a remap which will work with a offset different from 0
-    m_map.sync();
+    if (sync_before_remap)
+        sync();
     m_map.unmap();
     m_map.map(f, File::access_ReadWrite, window_size, 0, m_base_ref);
     return true;
@@ -136,6 +143,7 @@ GroupWriter::MapWindow::~MapWindow()
 void GroupWriter::MapWindow::sync()
 {
     m_map.sync();
+    ++num_window_syncs;
 }
 
 char* GroupWriter::MapWindow::translate(ref_type ref)
@@ -261,6 +269,11 @@ GroupWriter::GroupWriter(Group& group, Durability dura)
 
 GroupWriter::~GroupWriter() = default;
 
+size_t GroupWriter::get_num_window_syncs() noexcept
+{
+    return num_window_syncs.load();
+}
+
 size_t GroupWriter::get_file_size() const noexcept
 {
     auto sz = to_size_t(m_alloc.get_file().get_size());
@@ -269,7 +282,7 @@ size_t GroupWriter::get_file_size() const noexcept
 
 void GroupWriter::sync_all_mappings()
 {
-    if (m_durability == Durability::Unsafe)
+    if (!windows_need_sync())
         return;
     for (const auto& window : m_map_windows) {
         window->sync();
@@ -282,8 +295,10 @@ void GroupWriter::sync_all_mappings()
 // used policy. Entries in the cache are kept in MRU order.
 GroupWriter::MapWindow* GroupWriter::get_window(ref_type start_ref, size_t size)
 {
+    bool sync = windows_need_sync();
     auto match = std::find_if(m_map_windows.begin(), m_map_windows.end(), [=](auto& window) {
-        return window->matches(start_ref, size) || window->extends_to_match(m_alloc.get_file(), start_ref, size);
+        return window->matches(start_ref, size) ||
+               window->extends_to_match(m_alloc.get_file(), start_ref, size, sync);
     });
     if (match != m_map_windows.end()) {
         // move matching window to top (to keep LRU order)
@@ -292,7 +307,7 @@ GroupWriter::MapWindow* GroupWriter::get_window(ref_type start_ref, size_t size)
     }
     // no window found, make room for a new one at the top
     if (m_map_windows.size() == num_map_windows) {
-        if (m_durability != Durability::Unsafe)
+        if (sync)
             m_map_windows.back()->sync();
         m_map_windows.pop_back();
     }
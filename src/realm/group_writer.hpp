@@ -69,8 +69,16 @@ public:
     /// returned by write_group().
     void commit(ref_type new_top_ref);
 
+    /// Flush everything written so far to physical medium without touching
+    /// the file header. Does nothing in the durability modes that never sync.
+    void sync_all_mappings();
+
     size_t get_file_size() const noexcept;
 
+    /// The number of times any GroupWriter in this process has synced one of
+    /// its write windows to disk.
+    static size_t get_num_window_syncs() noexcept;
+
     ref_type write_array(const char*, size_t, uint32_t) override;
 
 #ifdef REALM_DEBUG
@@ -141,8 +149,13 @@ private:
     // the least recently used and sync'ing it to disk
     MapWindow* get_window(ref_type start_ref, size_t size);
 
-    // Sync all cached memory mappings
-    void sync_all_mappings();
+    // With Durability::Unsafe nothing is guaranteed to reach the disk, and with
+    // Durability::MemOnly the file is only used as backing for shared memory, so
+    // in those modes the windows are never synced.
+    bool windows_need_sync() const noexcept
+    {
+        return m_durability != Durability::Unsafe && m_durability != Durability::MemOnly;
+    }
 
     /// Allocate a chunk of free space of the specified size. The
     /// specified size must be 8-byte aligned. Extend the file if
@@ -401,38 +401,34 @@ key_type generate_key(key_type upper, key_type lower, int permutation) {
 }
 
 
-// Helper structure for IndexArray::index_string_all_ins to generate and keep track of search key permutations,
-// when traversing the trees.
+// Helper structure for IndexArray::index_string_all_ins to keep track of the nodes left to visit when
+// traversing the trees. Rather than descending once for every upper/lower permutation of a key, each
+// node is visited once and the sorted, distinct permutations of the key at that level are looked up in
+// it one after the other.
 struct SearchList {
     struct Item {
         const char* header;
         size_t string_offset;
-        key_type key;
+    };
+
+    // The distinct permutations of the key at one level, in ascending order
+    struct Level {
+        std::array<key_type, 16> keys; // 4 bytes gives up to 16 search keys
+        size_t size;
     };
 
     SearchList(const util::Optional<std::string>& upper_value, const util::Optional<std::string>& lower_value)
         : m_upper_value(upper_value)
         , m_lower_value(lower_value)
     {
-        m_keys_seen.reserve(num_permutations);
     }
 
-    // Add all unique keys for this level to the internal work stack
-    void add_all_for_level(const char* header, size_t string_offset)
+    const Level& get_level(size_t string_offset)
     {
-        m_keys_seen.clear();
-        const key_type upper_key = StringIndex::create_key(m_upper_value, string_offset);
-        const key_type lower_key = StringIndex::create_key(m_lower_value, string_offset);
-        for (int p = 0; p < num_permutations; ++p) {
-            // FIXME: This might still be incorrect due to multi-byte unicode characters (crossing the 4 byte key
-            // size) being combined incorrectly.
-            const key_type key = generate_key(upper_key, lower_key, p);
-            const bool new_key = std::find(m_keys_seen.cbegin(), m_keys_seen.cend(), key) == m_keys_seen.cend();
-            if (new_key) {
-                m_keys_seen.push_back(key);
-                add_next(header, string_offset, key);
-            }
-        }
+        const size_t level_ndx = string_offset / 4;
+        while (m_levels.size() <= level_ndx)
+            m_levels.push_back(make_level(m_levels.size() * 4));
+        return m_levels[level_ndx];
     }
 
     bool empty() const
@@ -447,21 +443,40 @@ struct SearchList {
         return item;
     }
 
-    // Add a single entry to the internal work stack. Used to traverse the inner trees (same key)
-    void add_next(const char* header, size_t string_offset, key_type key)
+    // Add a single node to the internal work stack
+    void add_next(const char* header, size_t string_offset)
     {
-        m_items.push_back({header, string_offset, key});
+        m_items.push_back({header, string_offset});
     }
 
 private:
-    static constexpr int num_permutations = 1 << sizeof(key_type); // 4 bytes gives up to 16 search keys
+    static constexpr int num_permutations = 1 << sizeof(key_type);
+
+    Level make_level(size_t string_offset) const
+    {
+        const key_type upper_key = StringIndex::create_key(m_upper_value, string_offset);
+        const key_type lower_key = StringIndex::create_key(m_lower_value, string_offset);
+        Level level;
+        level.keys[0] = upper_key;
+        level.size = 1;
+        if (upper_key != lower_key) {
+            for (int p = 1; p < num_permutations; ++p) {
+                // FIXME: This might still be incorrect due to multi-byte unicode characters (crossing the 4 byte
+                // key size) being combined incorrectly.
+                level.keys[p] = generate_key(upper_key, lower_key, p);
+            }
+            // Keys are compared as signed 32 bit integers, just like the index stores them
+            std::sort(level.keys.begin(), level.keys.end());
+            level.size = std::unique(level.keys.begin(), level.keys.end()) - level.keys.begin();
+        }
+        return level;
+    }
 
     std::vector<Item> m_items;
+    std::vector<Level> m_levels;
 
     const util::Optional<std::string> m_upper_value;
     const util::Optional<std::string> m_lower_value;
-
-    std::vector<key_type> m_keys_seen;
 };
 
 
@@ -482,73 +497,79 @@ void IndexArray::index_string_all_ins(StringData value, std::vector<ObjKey>& res
     SearchList search_list(upper_value, lower_value);
 
     const char* top_header = get_header_from_data(m_data);
-    search_list.add_all_for_level(top_header, 0);
+    search_list.add_next(top_header, 0);
 
     while (!search_list.empty()) {
         SearchList::Item item = search_list.get_next();
 
         const char* const header = item.header;
         const size_t string_offset = item.string_offset;
-        const key_type key = item.key;
+        const SearchList::Level& level = search_list.get_level(string_offset);
         const char* const data = get_data_from_header(header);
         const uint_least8_t width = get_width_from_header(header);
         const bool is_inner_node = get_is_inner_bptree_node_from_header(header);
 
         // Get subnode table
         ref_type offsets_ref = to_ref(get_direct(data, width, 0));
-
-        // Find the position matching the key
         const char* const offsets_header = m_alloc.translate(offsets_ref);
         const char* const offsets_data = get_data_from_header(offsets_header);
         const size_t offsets_size = get_size_from_header(offsets_header);
-        const size_t pos = ::lower_bound<32>(offsets_data, offsets_size, key); // keys are always 32 bits wide
-
-        // If key is outside range, we know there can be no match
-        if (pos == offsets_size)
-            continue;
 
-        // Get entry under key
-        const size_t pos_refs = pos + 1; // first entry in refs points to offsets
-        const int64_t ref = get_direct(data, width, pos_refs);
+        // Seek to each permutation in turn. As they are sorted, every search can start where the previous one
+        // ended.
+        size_t pos = 0;
+        for (size_t i = 0; i < level.size && pos < offsets_size; ++i) {
+            const key_type key = level.keys[i];
+            // keys are always 32 bits wide
+            pos += ::lower_bound<32>(offsets_data + pos * 4, offsets_size - pos, key);
+            if (pos == offsets_size)
+                break;
+
+            // Get entry under key
+            const size_t pos_refs = pos + 1; // first entry in refs points to offsets
+            const int64_t ref = get_direct(data, width, pos_refs);
+
+            if (is_inner_node) {
+                // The stored key is the last key of the child, so this is the only child that can hold the
+                // permutation. Later permutations that land in the same child must not add it again.
+                search_list.add_next(m_alloc.translate(to_ref(ref)), string_offset);
+                const key_type last_key = key_type(get_direct<32>(offsets_data, pos));
+                while (i + 1 < level.size && level.keys[i + 1] <= last_key)
+                    ++i;
+                ++pos;
+                continue;
+            }
 
-        if (is_inner_node) {
-            // Set vars for next iteration
-            const char* const inner_header = m_alloc.translate(to_ref(ref));
-            search_list.add_next(inner_header, string_offset, key);
-            continue;
-        }
+            if (key_type(get_direct<32>(offsets_data, pos)) != key)
+                continue;
 
-        const key_type stored_key = key_type(get_direct<32>(offsets_data, pos));
+            // Literal row index (tagged)
+            if (ref & 1) {
+                ObjKey k = ObjKey(ref >> 1);
 
-        if (stored_key != key)
-            continue;
+                // The buffer is needed when for when this is an integer index.
+                StringConversionBuffer buffer;
+                const StringData str = column.get_index_data(k, buffer);
+                const util::Optional<std::string> upper_str = case_map(str, true);
+                if (upper_str == upper_value) {
+                    result.push_back(k);
+                }
+                continue;
+            }
 
-        // Literal row index (tagged)
-        if (ref & 1) {
-            ObjKey k = ObjKey(ref >> 1);
+            const char* const sub_header = m_alloc.translate(to_ref(ref));
+            const bool sub_isindex = get_context_flag_from_header(sub_header);
 
-            // The buffer is needed when for when this is an integer index.
-            StringConversionBuffer buffer;
-            const StringData str = column.get_index_data(k, buffer);
-            const util::Optional<std::string> upper_str = case_map(str, true);
-            if (upper_str == upper_value) {
-                result.push_back(k);
+            // List of row indices with common prefix up to this point, in sorted order.
+            if (!sub_isindex) {
+                const IntegerColumn sub(m_alloc, to_ref(ref));
+                from_list_all_ins(upper_value, result, sub, column);
+                continue;
             }
-            continue;
-        }
-
-        const char* const sub_header = m_alloc.translate(to_ref(ref));
-        const bool sub_isindex = get_context_flag_from_header(sub_header);
 
-        // List of row indices with common prefix up to this point, in sorted order.
-        if (!sub_isindex) {
-            const IntegerColumn sub(m_alloc, to_ref(ref));
-            from_list_all_ins(upper_value, result, sub, column);
-            continue;
+            // Recurse into sub-index;
+            search_list.add_next(sub_header, string_offset + 4);
         }
-
-        // Recurse into sub-index;
-        search_list.add_all_for_level(sub_header, string_offset + 4);
     }
 
     // sort the result and return a std::vector
@@ -797,6 +818,41 @@ void StringIndex::insert_row_list(size_t ref, size_t offset, StringData value)
 }
 
 
+// Moves the entry in `slot_value` (a tagged object key or a list of duplicates
+// of `slot_str`) into a new subindex together with `value`. When the strings
+// share a long prefix, the chain of single key subindexes down to the level
+// where they differ is built directly, instead of having every level collide
+// again and look up the existing string from the column.
+ref_type StringIndex::create_subindex_chain(uint64_t slot_value, StringData slot_str, ObjKey key, StringData value,
+                                            size_t offset)
+{
+    Allocator& alloc = m_array->get_alloc();
+
+    size_t bottom_offset = offset;
+    while (create_key(value, bottom_offset) == create_key(slot_str, bottom_offset) &&
+           bottom_offset + s_index_key_length <= s_max_offset)
+        bottom_offset += s_index_key_length;
+
+    StringIndex bottom(m_target_column, alloc);
+    if ((slot_value & 1) != 0) {
+        bottom.insert_with_offset(ObjKey(int64_t(slot_value >> 1)), slot_str, bottom_offset);
+    }
+    else {
+        bottom.insert_row_list(ref_type(slot_value), bottom_offset, slot_str);
+    }
+    bottom.insert_with_offset(key, value, bottom_offset);
+
+    ref_type ref = bottom.get_ref();
+    while (bottom_offset > offset) {
+        bottom_offset -= s_index_key_length;
+        StringIndex level(m_target_column, alloc);
+        level.insert_row_list(ref, bottom_offset, value);
+        ref = level.get_ref();
+    }
+    return ref;
+}
+
+
 void StringIndex::TreeInsert(ObjKey obj_key, key_type key, size_t offset, StringData value)
 {
     NodeChange nc = do_insert(obj_key, key, offset, value);
@@ -1082,13 +1138,11 @@ bool StringIndex::leaf_insert(ObjKey obj_key, key_type key, size_t offset, Strin
             }
             else {
                 // These strings have the same prefix up to this point but they
-                // are actually not equal. Extend the tree recursivly until the
-                // prefix of these strings is different.
-                StringIndex subindex(m_target_column, m_array->get_alloc());
-                subindex.insert_with_offset(obj_key2, v2, suboffset);
-                subindex.insert_with_offset(obj_key, value, suboffset);
+                // are actually not equal. Extend the tree until the prefix of
+                // these strings is different.
+                ref_type chain_ref = create_subindex_chain(slot_value, v2, obj_key, value, suboffset);
                 // Join the string of SubIndices to the current position of m_array
-                m_array->set(ins_pos_refs, subindex.get_ref());
+                m_array->set(ins_pos_refs, chain_ref);
             }
         }
         return true;
@@ -1150,10 +1204,8 @@ bool StringIndex::leaf_insert(ObjKey obj_key, key_type key, size_t offset, Strin
                 // The buffer is needed for when this is an integer index.
                 StringConversionBuffer buffer;
                 StringData v2 = get(key_of_any_dup, buffer);
-                StringIndex subindex(m_target_column, m_array->get_alloc());
-                subindex.insert_row_list(sub.get_ref(), suboffset, v2);
-                subindex.insert_with_offset(obj_key, value, suboffset);
-                m_array->set(ins_pos_refs, subindex.get_ref());
+                ref_type chain_ref = create_subindex_chain(sub.get_ref(), v2, obj_key, value, suboffset);
+                m_array->set(ins_pos_refs, chain_ref);
             }
         }
         return true;
@@ -1167,7 +1219,8 @@ bool StringIndex::leaf_insert(ObjKey obj_key, key_type key, size_t offset, Strin
 }
 
 
-void StringIndex::distinct(BPlusTree<ObjKey>& result) const
+template <class F>
+void StringIndex::for_each_distinct(F&& func) const
 {
     Allocator& alloc = m_array->get_alloc();
     const size_t array_size = m_array->size();
@@ -1177,7 +1230,7 @@ void StringIndex::distinct(BPlusTree<ObjKey>& result) const
         for (size_t i = 1; i < array_size; ++i) {
             size_t ref = m_array->get_as_ref(i);
             StringIndex ndx(ref, nullptr, 0, m_target_column, alloc);
-            ndx.distinct(result);
+            ndx.for_each_distinct(func);
         }
     }
     else {
@@ -1187,20 +1240,20 @@ void StringIndex::distinct(BPlusTree<ObjKey>& result) const
             // low bit set indicate literal ref (shifted)
             if (ref & 1) {
                 ObjKey k = ObjKey((uint64_t(ref) >> 1));
-                result.add(k);
+                func(k, 1);
             }
             else {
                 // A real ref either points to a list or a subindex
                 char* header = alloc.translate(to_ref(ref));
                 if (Array::get_context_flag_from_header(header)) {
                     StringIndex ndx(to_ref(ref), m_array.get(), i, m_target_column, alloc);
-                    ndx.distinct(result);
+                    ndx.for_each_distinct(func);
                 }
                 else {
                     IntegerColumn sub(alloc, to_ref(ref)); // Throws
                     if (sub.size() == 1) {                 // Optimization.
                         ObjKey k = ObjKey(sub.get(0));     // get first match
-                        result.add(k);
+                        func(k, 1);
                     }
                     else {
                         // Add all unique values from this sorted list
@@ -1209,9 +1262,11 @@ void StringIndex::distinct(BPlusTree<ObjKey>& result) const
                         SortedListComparator slc(m_target_column);
                         StringConversionBuffer buffer;
                         while (it != it_end) {
-                            result.add(ObjKey(*it));
-                            StringData it_data = get(ObjKey(*it), buffer);
-                            it = std::upper_bound(it, it_end, it_data, slc);
+                            ObjKey k = ObjKey(*it);
+                            StringData it_data = get(k, buffer);
+                            auto next = std::upper_bound(it, it_end, it_data, slc);
+                            func(k, size_t(next - it));
+                            it = next;
                         }
                     }
                 }
@@ -1220,6 +1275,16 @@ void StringIndex::distinct(BPlusTree<ObjKey>& result) const
     }
 }
 
+void StringIndex::distinct(BPlusTree<ObjKey>& result) const
+{
+    for_each_distinct([&result](ObjKey k, size_t) { result.add(k); });
+}
+
+void StringIndex::distinct_count(std::vector<std::pair<ObjKey, size_t>>& result) const
+{
+    for_each_distinct([&result](ObjKey k, size_t count) { result.emplace_back(k, count); });
+}
+
 StringData StringIndex::get(ObjKey key, StringConversionBuffer& buffer) const
 {
     return m_target_column.get_index_data(key, buffer);
@@ -218,6 +218,8 @@ public:
     void clear();
 
     void distinct(BPlusTree<ObjKey>& result) const;
+    // For each distinct value, get the first matching object and the number of matches
+    void distinct_count(std::vector<std::pair<ObjKey, size_t>>& result) const;
     bool has_duplicate_values() const noexcept;
 
     void verify() const;
@@ -273,8 +275,13 @@ private:
 
     static IndexArray* create_node(Allocator&, bool is_leaf);
 
+    template <class F>
+    void for_each_distinct(F&& func) const;
+
     void insert_with_offset(ObjKey key, StringData value, size_t offset);
     void insert_row_list(size_t ref, size_t offset, StringData value);
+    ref_type create_subindex_chain(uint64_t slot_value, StringData slot_str, ObjKey key, StringData value,
+                                   size_t offset);
     void insert_to_existing_list(ObjKey key, StringData value, IntegerColumn& list);
     void insert_to_existing_list_at_lower(ObjKey key, StringData value, IntegerColumn& list,
                                           const IntegerColumnIterator& lower);
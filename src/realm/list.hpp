@@ -549,8 +549,8 @@ public:
 
     void resize(size_t new_size) override
     {
-        update_if_needed();
-        size_t current_size = m_tree->size();
+        // size() also picks up changes made through other accessors
+        size_t current_size = size();
         while (new_size > current_size) {
             insert_null(current_size++);
         }
@@ -624,9 +624,40 @@ public:
 
     void remove(size_t from, size_t to) override
     {
+        REALM_ASSERT_DEBUG(!update_if_needed());
+        if (from >= to)
+            return;
+        if (to > size())
+            throw std::out_of_range("Index out of range");
+        Replication* repl = this->m_const_obj->get_replication();
+        if (from == 0 && to == size() && !std::is_same<T, ObjKey>::value) {
+            // Dropping the whole tree is much cheaper than erasing one element
+            // at a time. The erases are still replicated one by one, as this is
+            // not a clear(). Links take the loop below to update backlinks.
+            ensure_writeable();
+            if (repl) {
+                for (size_t ndx = to; ndx--;)
+                    ConstLstBase::erase_repl(repl, ndx);
+            }
+            // Every index up to the old end() is now deleted
+            size_t end = to + m_deleted.size();
+            m_tree->clear();
+            m_deleted.resize(end);
+            for (size_t ndx = 0; ndx < end; ++ndx)
+                m_deleted[ndx] = ndx;
+            m_obj.bump_content_version();
+            return;
+        }
         while (from < to) {
-            remove(--to);
+            --to;
+            ensure_writeable();
+            if (repl) {
+                ConstLstBase::erase_repl(repl, to);
+            }
+            do_remove(to);
+            ConstLstBase::adj_remove(to);
         }
+        m_obj.bump_content_version();
     }
 
     void move(size_t from, size_t to) override
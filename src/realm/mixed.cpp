@@ -141,6 +141,55 @@ int Mixed::compare(const Mixed& b) const
     return 0;
 }
 
+namespace {
+template <class Float>
+size_t hash_float(Float f)
+{
+    // 0.0 and -0.0 compare equal, and every NaN hashes alike so that the
+    // hash does not depend on the payload bits of a NaN.
+    if (std::isnan(f))
+        return 1;
+    return f == 0 ? 0 : std::hash<Float>()(f);
+}
+} // anonymous namespace
+
+size_t Mixed::hash() const
+{
+    if (is_null())
+        return 0;
+
+    switch (get_type()) {
+        case type_Int:
+            return std::hash<int64_t>()(get<int64_t>());
+        case type_String:
+            return get<StringData>().hash();
+        case type_Binary: {
+            BinaryData bin = get<BinaryData>();
+            return StringData(bin.data(), bin.size()).hash();
+        }
+        case type_Float:
+            return hash_float(get<float>());
+        case type_Double:
+            return hash_float(get<double>());
+        case type_Bool:
+            return std::hash<bool>()(get<bool>());
+        case type_Timestamp: {
+            Timestamp ts = get<Timestamp>();
+            return std::hash<int64_t>()(ts.get_seconds()) ^ std::hash<int32_t>()(ts.get_nanoseconds());
+        }
+        case type_Link:
+            return std::hash<ObjKey>()(get<ObjKey>());
+        case type_OldTable:
+        case type_OldDateTime:
+        case type_OldMixed:
+        case type_LinkList:
+            REALM_ASSERT_RELEASE(false && "Hash not supported for this column type");
+            break;
+    }
+
+    return 0;
+}
+
 // LCOV_EXCL_START
 std::ostream& operator<<(std::ostream& out, const Mixed& m)
 {
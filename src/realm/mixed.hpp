@@ -166,6 +166,8 @@ public:
 
     bool is_null() const;
     int compare(const Mixed& b) const;
+    // Values comparing equal have the same hash
+    size_t hash() const;
     bool operator==(const Mixed& other) const
     {
         return compare(other) == 0;
@@ -410,4 +412,14 @@ std::ostream& operator<<(std::ostream& out, const Mixed& m);
 
 } // namespace realm
 
+namespace std {
+template <>
+struct hash<::realm::Mixed> {
+    inline size_t operator()(const ::realm::Mixed& m) const noexcept
+    {
+        return m.hash();
+    }
+};
+} // namespace std
+
 #endif // REALM_MIXED_HPP
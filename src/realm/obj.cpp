@@ -1053,6 +1053,11 @@ void Obj::add_backlink(ColKey backlink_col_key, ObjKey origin_key)
 }
 
 bool Obj::remove_one_backlink(ColKey backlink_col_key, ObjKey origin_key)
+{
+    return remove_backlinks(backlink_col_key, origin_key, 1);
+}
+
+bool Obj::remove_backlinks(ColKey backlink_col_key, ObjKey origin_key, size_t count)
 {
     ensure_writeable();
 
@@ -1066,7 +1071,7 @@ bool Obj::remove_one_backlink(ColKey backlink_col_key, ObjKey origin_key)
     backlinks.set_parent(&fields, backlink_col_ndx.val + 1);
     backlinks.init_from_parent();
 
-    return backlinks.remove(m_row_ndx, origin_key);
+    return backlinks.remove(m_row_ndx, origin_key, count);
 }
 
 void Obj::nullify_link(ColKey origin_col_key, ObjKey target_key)
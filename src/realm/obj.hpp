@@ -304,6 +304,7 @@ private:
     void set_int(ColKey col_key, int64_t value);
     void add_backlink(ColKey backlink_col, ObjKey origin_key);
     bool remove_one_backlink(ColKey backlink_col, ObjKey origin_key);
+    bool remove_backlinks(ColKey backlink_col, ObjKey origin_key, size_t count);
     void nullify_link(ColKey origin_col, ObjKey target_key);
     // Used when inserting a new link. You will not remove existing links in this process
     void set_backlink(ColKey col_key, ObjKey new_key) const;
@@ -397,9 +398,17 @@ Obj& Obj::set_list_values(ColKey col_key, const std::vector<U>& values)
 {
     size_t sz = values.size();
     auto list = get_list<U>(col_key);
-    list.resize(sz);
-    for (size_t i = 0; i < sz; i++)
+    size_t list_sz = list.size();
+    if (sz < list_sz) {
+        list.remove(sz, list_sz);
+        list_sz = sz;
+    }
+    for (size_t i = 0; i < list_sz; i++)
         list.set(i, values[i]);
+    // Insert new values directly instead of padding with null and overwriting
+    for (size_t i = list_sz; i < sz; i++)
+        list.insert(i, values[i]);
+    bump_both_versions();
 
     return *this;
 }
@@ -73,12 +73,25 @@ void ObjList::do_sort(const DescriptorOrdering& ordering)
     }
     // Apply the results
     m_limit_count = index_pairs.m_removed_by_limit;
-    m_key_values->clear();
-    for (auto& pair : index_pairs) {
-        m_key_values->add(pair.key_for_object);
+    // The result never holds more keys than before. Rather than rebuilding the
+    // tree one key at a time, drop the surplus from the back and overwrite the
+    // remaining keys in place.
+    size_t num_valid = index_pairs.size();
+    size_t new_sz = num_valid + detached_ref_count;
+    REALM_ASSERT_3(new_sz, <=, sz);
+    if (new_sz < sz / 2) {
+        m_key_values->clear();
     }
-    for (size_t t = 0; t < detached_ref_count; ++t)
-        m_key_values->add(null_key);
+    else {
+        while (m_key_values->size() > new_sz)
+            m_key_values->erase(m_key_values->size() - 1);
+    }
+    size_t in_place = m_key_values->size();
+    m_key_values->set_range(in_place, [&](size_t i) {
+        return i < num_valid ? index_pairs[i].key_for_object : null_key;
+    });
+    for (size_t t = in_place; t < new_sz; ++t)
+        m_key_values->add(t < num_valid ? index_pairs[t].key_for_object : null_key);
 }
 
 ObjList::ObjList(KeyColumn* key_values)
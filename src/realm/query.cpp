@@ -325,6 +325,45 @@ struct MakeConditionNode<StringNode<Cond>> {
     }
 };
 
+// Create a node testing both bounds in one pass. Returns null if the range has
+// to be expressed as a pair of conditions instead.
+std::unique_ptr<ParentNode> make_between_node(const Table& table, ColKey column_key, int64_t from, int64_t to)
+{
+    table.check_column(column_key);
+    if (column_key.get_type() != col_type_Int || column_key.get_attrs().test(col_attr_List))
+        return {};
+    if (column_key.get_attrs().test(col_attr_Nullable))
+        return std::unique_ptr<ParentNode>{new BetweenNode<ArrayIntNull, int64_t>(from, to, column_key)};
+    return std::unique_ptr<ParentNode>{new BetweenNode<ArrayInteger, int64_t>(from, to, column_key)};
+}
+
+std::unique_ptr<ParentNode> make_between_node(const Table& table, ColKey column_key, float from, float to)
+{
+    table.check_column(column_key);
+    if (column_key.get_type() != col_type_Float || column_key.get_attrs().test(col_attr_List) ||
+        null::is_null_float(from) || null::is_null_float(to))
+        return {};
+    return std::unique_ptr<ParentNode>{new BetweenNode<ArrayFloat, float>(from, to, column_key)};
+}
+
+std::unique_ptr<ParentNode> make_between_node(const Table& table, ColKey column_key, double from, double to)
+{
+    table.check_column(column_key);
+    if (column_key.get_type() != col_type_Double || column_key.get_attrs().test(col_attr_List) ||
+        null::is_null_float(from) || null::is_null_float(to))
+        return {};
+    return std::unique_ptr<ParentNode>{new BetweenNode<ArrayDouble, double>(from, to, column_key)};
+}
+
+std::unique_ptr<ParentNode> make_between_node(const Table& table, ColKey column_key, Timestamp from, Timestamp to)
+{
+    table.check_column(column_key);
+    if (column_key.get_type() != col_type_Timestamp || column_key.get_attrs().test(col_attr_List) ||
+        from.is_null() || to.is_null())
+        return {};
+    return std::unique_ptr<ParentNode>{new BetweenNode<ArrayTimestamp, Timestamp>(from, to, column_key)};
+}
+
 template <class Cond, class T>
 std::unique_ptr<ParentNode> make_condition_node(const Table& table, ColKey column_key, T value)
 {
@@ -424,6 +463,20 @@ Query& Query::add_condition(ColKey column_key, T value)
 }
 
 
+template <class T>
+Query& Query::add_between(ColKey column_key, T from, T to)
+{
+    if (auto node = make_between_node(*m_table, column_key, from, to)) {
+        add_node(std::move(node));
+        return *this;
+    }
+    group();
+    greater_equal(column_key, from);
+    less_equal(column_key, to);
+    end_group();
+    return *this;
+}
+
 template <typename TConditionFunction>
 Query& Query::add_size_condition(ColKey column_key, int64_t value)
 {
@@ -664,11 +717,7 @@ Query& Query::less(ColKey column_key, int64_t value)
 }
 Query& Query::between(ColKey column_key, int64_t from, int64_t to)
 {
-    group();
-    greater_equal(column_key, from);
-    less_equal(column_key, to);
-    end_group();
-    return *this;
+    return add_between(column_key, from, to);
 }
 Query& Query::equal(ColKey column_key, bool value)
 {
@@ -708,11 +757,7 @@ Query& Query::less(ColKey column_key, float value)
 }
 Query& Query::between(ColKey column_key, float from, float to)
 {
-    group();
-    greater_equal(column_key, from);
-    less_equal(column_key, to);
-    end_group();
-    return *this;
+    return add_between(column_key, from, to);
 }
 
 
@@ -743,11 +788,7 @@ Query& Query::less(ColKey column_key, double value)
 }
 Query& Query::between(ColKey column_key, double from, double to)
 {
-    group();
-    greater_equal(column_key, from);
-    less_equal(column_key, to);
-    end_group();
-    return *this;
+    return add_between(column_key, from, to);
 }
 
 
@@ -776,6 +817,10 @@ Query& Query::less(ColKey column_key, Timestamp value)
 {
     return add_condition<Less>(column_key, value);
 }
+Query& Query::between(ColKey column_key, Timestamp from, Timestamp to)
+{
+    return add_between(column_key, from, to);
+}
 
 // ------------- size
 Query& Query::size_equal(ColKey column_key, int64_t value)
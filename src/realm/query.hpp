@@ -171,6 +171,7 @@ public:
     Query& greater_equal(ColKey column_key, Timestamp value);
     Query& less_equal(ColKey column_key, Timestamp value);
     Query& less(ColKey column_key, Timestamp value);
+    Query& between(ColKey column_key, Timestamp from, Timestamp to);
 
     // Conditions: size
     Query& size_equal(ColKey column_key, int64_t value);
@@ -326,6 +327,9 @@ private:
     template <typename TConditionFunction>
     Query& add_size_condition(ColKey column_key, int64_t value);
 
+    template <class T>
+    Query& add_between(ColKey column_key, T from, T to);
+
     template <typename T, bool Nullable>
     double average(ColKey column_key, size_t* resultcount = nullptr) const;
 
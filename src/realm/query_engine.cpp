@@ -379,14 +379,11 @@ void StringNode<EqualIns>::_search_index_init()
 size_t StringNode<EqualIns>::_find_first_local(size_t start, size_t end)
 {
     EqualIns cond;
-    for (size_t s = start; s < end; ++s) {
-        StringData t = get_string(s);
+    const StringData value(m_value);
+    const char* ucase = m_ucase.c_str();
+    const char* lcase = m_lcase.c_str();
 
-        if (cond(StringData(m_value), m_ucase.c_str(), m_lcase.c_str(), t))
-            return s;
-    }
-
-    return not_found;
+    return m_leaf_ptr->find_first_if([&](StringData t) { return cond(value, ucase, lcase, t); }, start, end);
 }
 
 } // namespace realm
@@ -706,26 +706,37 @@ public:
     }
 };
 
+// Leaves that provide find_first_if() scan with their own loop, the others are scanned through get()
+template <class LeafType, class Pred>
+static auto find_first_if_in_leaf(LeafType& leaf, Pred&& pred, size_t start, size_t end, int)
+    -> decltype(leaf.find_first_if(pred, start, end))
+{
+    return leaf.find_first_if(pred, start, end);
+}
+
+template <class LeafType, class Pred>
+static size_t find_first_if_in_leaf(LeafType& leaf, Pred&& pred, size_t start, size_t end, long)
+{
+    for (size_t i = start; i < end; ++i) {
+        if (pred(leaf.get(i)))
+            return i;
+    }
+    return realm::npos;
+}
+
 template <size_t linear_search_threshold, class LeafType, class NeedleContainer>
 static size_t find_first_haystack(LeafType& leaf, NeedleContainer& needles, size_t start, size_t end)
 {
     // for a small number of conditions, it is faster to do a linear search than to compute the hash
     // the exact thresholds were found experimentally
     if (needles.size() < linear_search_threshold) {
-        for (size_t i = start; i < end; ++i) {
-            auto element = leaf.get(i);
-            if (std::find(needles.begin(), needles.end(), element) != needles.end())
-                return i;
-        }
+        return find_first_if_in_leaf(
+            leaf,
+            [&](const auto& element) { return std::find(needles.begin(), needles.end(), element) != needles.end(); },
+            start, end, 0);
     }
-    else {
-        for (size_t i = start; i < end; ++i) {
-            auto element = leaf.get(i);
-            if (needles.count(element))
-                return i;
-        }
-    }
-    return realm::npos;
+    return find_first_if_in_leaf(
+        leaf, [&](const auto& element) { return needles.count(element) != 0; }, start, end, 0);
 }
 
 template <class LeafType>
@@ -1226,14 +1237,7 @@ public:
 
     size_t find_first_local(size_t start, size_t end) override
     {
-        TConditionFunction condition;
-        bool m_value_is_null = !m_value;
-        for (size_t s = start; s < end; ++s) {
-            util::Optional<bool> value = m_leaf_ptr->get(s);
-            if (condition(value, m_value, !value, m_value_is_null))
-                return s;
-        }
-        return not_found;
+        return find_first_in_leaf(TConditionFunction(), start, end);
     }
 
     virtual std::string describe(util::serializer::SerialisationState& state) const override
@@ -1248,6 +1252,30 @@ public:
     }
 
 private:
+    // Null is stored as a distinct value in the leaf, so (in)equality can be
+    // searched for a word at a time like in any integer array
+    size_t find_first_in_leaf(Equal, size_t start, size_t end)
+    {
+        return m_leaf_ptr->find_first<Equal>(m_value, start, end);
+    }
+
+    size_t find_first_in_leaf(NotEqual, size_t start, size_t end)
+    {
+        return m_leaf_ptr->find_first<NotEqual>(m_value, start, end);
+    }
+
+    template <class Cond>
+    size_t find_first_in_leaf(Cond condition, size_t start, size_t end)
+    {
+        bool m_value_is_null = !m_value;
+        for (size_t s = start; s < end; ++s) {
+            util::Optional<bool> value = m_leaf_ptr->get(s);
+            if (condition(value, m_value, !value, m_value_is_null))
+                return s;
+        }
+        return not_found;
+    }
+
     util::Optional<bool> m_value;
     using LeafCacheStorage = typename std::aligned_storage<sizeof(ArrayBoolNull), alignof(ArrayBoolNull)>::type;
     using LeafPtr = std::unique_ptr<ArrayBoolNull, PlacementDelete>;
@@ -1325,6 +1353,145 @@ public:
     }
 };
 
+// Matches values in the closed range [from, to]. Both bounds are tested in
+// the same pass over the leaf instead of by two chained condition nodes.
+template <class LeafType, class T>
+class BetweenNode : public ParentNode {
+public:
+    BetweenNode(T from, T to, ColKey column_key)
+        : m_from(from)
+        , m_to(to)
+    {
+        m_condition_column_key = column_key;
+    }
+
+    BetweenNode(const BetweenNode& from)
+        : ParentNode(from)
+        , m_from(from.m_from)
+        , m_to(from.m_to)
+    {
+    }
+
+    void cluster_changed() override
+    {
+        m_array_ptr = nullptr;
+        m_array_ptr = LeafPtr(new (&m_leaf_cache_storage) LeafType(m_table.unchecked_ptr()->get_alloc()));
+        m_cluster->init_leaf(this->m_condition_column_key, m_array_ptr.get());
+        m_leaf_ptr = m_array_ptr.get();
+    }
+
+    void init(bool will_query_ranges) override
+    {
+        ParentNode::init(will_query_ranges);
+        set_cost(m_leaf_ptr);
+    }
+
+    size_t find_first_local(size_t start, size_t end) override
+    {
+        return find_in_leaf(*m_leaf_ptr, start, end);
+    }
+
+    std::string describe(util::serializer::SerialisationState& state) const override
+    {
+        REALM_ASSERT(m_condition_column_key);
+        std::string column = state.describe_column(ParentNode::m_table, m_condition_column_key);
+        return "(" + column + " >= " + util::serializer::print_value(m_from) + " and " + column +
+               " <= " + util::serializer::print_value(m_to) + ")";
+    }
+
+    std::unique_ptr<ParentNode> clone() const override
+    {
+        return std::unique_ptr<ParentNode>(new BetweenNode(*this));
+    }
+
+private:
+    T m_from;
+    T m_to;
+    using LeafCacheStorage = typename std::aligned_storage<sizeof(LeafType), alignof(LeafType)>::type;
+    using LeafPtr = std::unique_ptr<LeafType, PlacementDelete>;
+    LeafCacheStorage m_leaf_cache_storage;
+    LeafPtr m_array_ptr;
+    const LeafType* m_leaf_ptr = nullptr;
+
+    template <class Leaf>
+    void set_cost(const Leaf*)
+    {
+        m_dT = 1.0;
+        m_dD = 100.0;
+    }
+    void set_cost(const ArrayInteger*)
+    {
+        m_dT = _impl::CostHeuristic<ArrayInteger>::dT();
+        m_dD = _impl::CostHeuristic<ArrayInteger>::dD();
+    }
+    void set_cost(const ArrayIntNull*)
+    {
+        m_dT = _impl::CostHeuristic<ArrayIntNull>::dT();
+        m_dD = _impl::CostHeuristic<ArrayIntNull>::dD();
+    }
+
+    // Integers: let the leaf search skip everything below the lower bound
+    // (and nulls), then test the upper bound on the element found. Only
+    // ArrayInteger gets the vectorized search here; ArrayIntNull scans
+    // element by element for any condition but Equal. The leaf search has
+    // no GreaterEqual, so search for > (m_from - 1).
+    template <class IntLeaf>
+    size_t find_in_int_leaf(const IntLeaf& leaf, size_t start, size_t end) const
+    {
+        if (m_to < m_from)
+            return not_found;
+        if (m_from == std::numeric_limits<int64_t>::min()) {
+            for (size_t s = start; s < end; ++s) {
+                if (is_below_upper(leaf.get(s)))
+                    return s;
+            }
+            return not_found;
+        }
+        while (start < end) {
+            size_t s = leaf.template find_first<Greater>(m_from - 1, start, end);
+            if (s == not_found)
+                return not_found;
+            if (is_below_upper(leaf.get(s)))
+                return s;
+            start = s + 1;
+        }
+        return not_found;
+    }
+    bool is_below_upper(int64_t v) const
+    {
+        return v <= m_to;
+    }
+    bool is_below_upper(util::Optional<int64_t> v) const
+    {
+        return v && *v <= m_to;
+    }
+    size_t find_in_leaf(const ArrayInteger& leaf, size_t start, size_t end) const
+    {
+        return find_in_int_leaf(leaf, start, end);
+    }
+    size_t find_in_leaf(const ArrayIntNull& leaf, size_t start, size_t end) const
+    {
+        return find_in_int_leaf(leaf, start, end);
+    }
+
+    // Floats: null is stored as a NaN, so it fails both comparisons
+    template <class FloatLeaf>
+    size_t find_in_leaf(const FloatLeaf& leaf, size_t start, size_t end) const
+    {
+        for (size_t s = start; s < end; ++s) {
+            T v = leaf.get(s);
+            if (v >= m_from && v <= m_to)
+                return s;
+        }
+        return not_found;
+    }
+
+    size_t find_in_leaf(const ArrayTimestamp& leaf, size_t start, size_t end) const
+    {
+        return leaf.find_first_between(m_from, m_to, start, end);
+    }
+};
+
 class StringNodeBase : public ParentNode {
 public:
     using TConditionValue = StringData;
@@ -1440,14 +1607,13 @@ public:
     size_t find_first_local(size_t start, size_t end) override
     {
         TConditionFunction cond;
+        const StringData value(m_value);
+        if (std::is_same<TConditionFunction, BeginsWith>::value)
+            return m_leaf_ptr->find_first_prefix(value, start, end);
 
-        for (size_t s = start; s < end; ++s) {
-            StringData t = get_string(s);
-
-            if (cond(StringData(m_value), m_ucase.c_str(), m_lcase.c_str(), t))
-                return s;
-        }
-        return not_found;
+        const char* ucase = m_ucase.c_str();
+        const char* lcase = m_lcase.c_str();
+        return m_leaf_ptr->find_first_if([&](StringData t) { return cond(value, ucase, lcase, t); }, start, end);
     }
 
     virtual std::string describe_condition() const override
@@ -1508,14 +1674,9 @@ public:
     size_t find_first_local(size_t start, size_t end) override
     {
         Contains cond;
+        const StringData value(m_value);
 
-        for (size_t s = start; s < end; ++s) {
-            StringData t = get_string(s);
-
-            if (cond(StringData(m_value), m_charmap, t))
-                return s;
-        }
-        return not_found;
+        return m_leaf_ptr->find_first_if([&](StringData t) { return cond(value, m_charmap, t); }, start, end);
     }
 
     virtual std::string describe_condition() const override
@@ -1588,17 +1749,18 @@ public:
     {
         ContainsIns cond;
 
-        for (size_t s = start; s < end; ++s) {
-            StringData t = get_string(s);
-            // The current behaviour is to return all results when querying for a null string.
-            // See comment above Query_NextGen_StringConditions on why every string including "" contains null.
-            if (!bool(m_value)) {
-                return s;
-            }
-            if (cond(StringData(m_value), m_ucase.c_str(), m_lcase.c_str(), m_charmap, t))
-                return s;
+        // The current behaviour is to return all results when querying for a null string.
+        // See comment above Query_NextGen_StringConditions on why every string including "" contains null.
+        if (!bool(m_value)) {
+            return start < end ? start : not_found;
         }
-        return not_found;
+
+        const StringData value(m_value);
+        const char* ucase = m_ucase.c_str();
+        const char* lcase = m_lcase.c_str();
+
+        auto pred = [&](StringData t) { return cond(value, ucase, lcase, m_charmap, t); };
+        return m_leaf_ptr->find_first_if(pred, start, end);
     }
 
     virtual std::string describe_condition() const override
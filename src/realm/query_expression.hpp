@@ -2795,12 +2795,15 @@ public:
         Allocator& alloc = get_base_table()->get_alloc();
         Value<ref_type> list_refs;
         get_lists(index, list_refs, 1);
+        // The size found in the header of the root is only the number of
+        // elements when the root is a leaf, so ask the tree instead
         size_t sz = 0;
         for (size_t i = 0; i < list_refs.m_values; i++) {
             ref_type val = list_refs.m_storage[i];
             if (val) {
-                char* header = alloc.translate(val);
-                sz += Array::get_size_from_header(header);
+                BPlusTree<T> list(alloc);
+                list.init_from_ref(val);
+                sz += list.size();
             }
         }
         auto v = make_value_for_link<typename util::RemoveOptional<T>::type>(false, sz);
@@ -2810,10 +2813,15 @@ public:
             if (list_ref) {
                 BPlusTree<T> list(alloc);
                 list.init_from_ref(list_ref);
-                size_t s = list.size();
-                for (size_t j = 0; j < s; j++) {
-                    v.m_storage.set(k++, list.get(j));
-                }
+                // Copy a leaf at a time instead of looking up each element from the root
+                list.traverse([&v, &k](BPlusTreeNode* node, size_t) {
+                    auto leaf = static_cast<typename BPlusTree<T>::LeafNode*>(node);
+                    size_t s = leaf->size();
+                    for (size_t j = 0; j < s; j++) {
+                        v.m_storage.set(k++, leaf->get(j));
+                    }
+                    return false;
+                });
             }
         }
         destination.import(v);
@@ -2957,10 +2965,14 @@ public:
             if (list_ref) {
                 BPlusTree<T> list(alloc);
                 list.init_from_ref(list_ref);
-                size_t s = list.size();
-                for (unsigned j = 0; j < s; j++) {
-                    op.accumulate(list.get(j));
-                }
+                list.traverse([&op](BPlusTreeNode* node, size_t) {
+                    auto leaf = static_cast<typename BPlusTree<T>::LeafNode*>(node);
+                    size_t s = leaf->size();
+                    for (size_t j = 0; j < s; j++) {
+                        op.accumulate(leaf->get(j));
+                    }
+                    return false;
+                });
             }
             if (op.is_null()) {
                 v.m_storage.set_null(i);
@@ -21,6 +21,8 @@
 #include <realm/db.hpp>
 #include <realm/util/assert.hpp>
 
+#include <unordered_set>
+
 using namespace realm;
 
 LinkPathPart::LinkPathPart(ColKey col_key, ConstTableRef source)
@@ -218,6 +220,20 @@ void DistinctDescriptor::execute(IndexPairs& v, const Sorter& predicate, const B
         v.erase(nulls, v.end());
     }
 
+    if (m_column_keys.size() == 1) {
+        // The values of the only column are already cached by the sorter, so
+        // a single pass over a hash set will do. The rows are visited in view
+        // order, so the first occurrence wins just like on the sorting path,
+        // and the order of the remaining rows is left untouched.
+        std::unordered_set<Mixed> seen;
+        seen.reserve(v.size());
+        auto duplicates = std::remove_if(v.begin(), v.end(), [&](const IP& index) {
+            return !seen.insert(index.cached_value).second;
+        });
+        v.erase(duplicates, v.end());
+        return;
+    }
+
     // Sort by the columns to distinct on
     std::sort(v.begin(), v.end(), std::ref(predicate));
 
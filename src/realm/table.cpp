@@ -17,6 +17,7 @@
  **************************************************************************/
 
 #include <stdexcept>
+#include <unordered_map>
 
 #ifdef REALM_DEBUG
 #include <iostream>
@@ -359,8 +360,14 @@ void Table::remove_recursive(CascadeState& cascade_state)
         cascade_state.m_to_be_nullified.clear();
 
         auto to_delete = std::move(cascade_state.m_to_be_deleted);
+        // Handle the objects grouped by table and in key order. This way each
+        // table accessor is looked up only once per round, and consecutive
+        // erasures mostly hit the same cluster.
+        std::sort(to_delete.begin(), to_delete.end());
+        TableRef table;
         for (auto obj : to_delete) {
-            auto table = group->get_table(obj.first);
+            if (!table || table->get_key() != obj.first)
+                table = group->get_table(obj.first);
             // This might add to the list of objects that should be deleted
             table->m_clusters.erase(obj.second, cascade_state);
         }
@@ -372,8 +379,10 @@ void Table::nullify_links(CascadeState& cascade_state)
 {
     Group* group = get_parent_group();
     REALM_ASSERT(group);
+    TableRef table;
     for (auto& to_delete : cascade_state.m_to_be_deleted) {
-        auto table = group->get_table(to_delete.first);
+        if (!table || table->get_key() != to_delete.first)
+            table = group->get_table(to_delete.first);
         table->m_clusters.nullify_links(to_delete.second, cascade_state);
     }
 }
@@ -440,6 +449,16 @@ TableKey Table::get_key_direct(Allocator& alloc, ref_type top_ref)
 }
 
 
+size_t Table::get_size_direct(Allocator& alloc, ref_type top_ref)
+{
+    Array table_top(alloc);
+    table_top.init_from_ref(top_ref);
+    if (table_top.size() > top_position_for_cluster_tree) {
+        return ClusterTree::size_from_ref(table_top.get_as_ref(top_position_for_cluster_tree), alloc);
+    }
+    return 0;
+}
+
 void Table::init(ref_type top_ref, ArrayParent* parent, size_t ndx_in_parent, bool is_writable, bool is_frzn)
 {
     REALM_ASSERT(!(is_writable && is_frzn));
@@ -1374,19 +1393,40 @@ bool Table::migrate_objects(ColKey pk_col_key)
         add_search_index(orig_row_ndx_col);
     }
 
-    for (size_t row_ndx = 0; row_ndx < number_of_objects; row_ndx++) {
-        Mixed pk_val;
+    // When the keys are not the row indexes, they are determined up front, and the
+    // objects are created in key order. This way objects are always appended to the
+    // last cluster, which leaves the clusters fully packed and avoids moving entries
+    // around in the clusters.
+    std::vector<std::pair<int64_t, size_t>> key_order;
+    if (!use_row_ndx_as_key) {
+        BPlusTreeBase* pk_column = oid_column ? nullptr : column_accessors[pk_col_key].get();
+        bool pk_nullable = pk_col_key && pk_col_key.get_attrs().test(col_attr_Nullable);
+        key_order.reserve(number_of_objects);
+        for (size_t row_ndx = 0; row_ndx < number_of_objects; row_ndx++) {
+            ObjKey obj_key;
+            if (oid_column) {
+                obj_key = oid_column->get(row_ndx);
+            }
+            else {
+                // Generate key from pk value
+                GlobalKey object_id{get_val_from_column(row_ndx, col_type_String, pk_nullable, pk_column)};
+                obj_key = global_to_local_object_id_hashed(object_id);
+            }
+            key_order.emplace_back(obj_key.value, row_ndx);
+        }
+        std::sort(key_order.begin(), key_order.end());
+    }
+
+    FieldValues init_values;
+    for (size_t i = 0; i < number_of_objects; i++) {
+        size_t row_ndx = use_row_ndx_as_key ? i : key_order[i].second;
         // Build a vector of values obtained from the old columns
-        FieldValues init_values;
+        init_values.clear();
         for (auto& it : column_accessors) {
             auto col_key = it.first;
             auto col_type = col_key.get_type();
             auto nullable = col_key.get_attrs().test(col_attr_Nullable);
-            auto val = get_val_from_column(row_ndx, col_type, nullable, it.second.get());
-            init_values.emplace_back(col_key, val);
-            if (col_key == pk_col_key) {
-                pk_val = val;
-            }
+            init_values.emplace_back(col_key, get_val_from_column(row_ndx, col_type, nullable, it.second.get()));
         }
         for (auto& it : ts_accessors) {
             init_values.emplace_back(it.first, Mixed(it.second->get(row_ndx)));
@@ -1398,14 +1438,7 @@ bool Table::migrate_objects(ColKey pk_col_key)
         }
         else {
             init_values.emplace_back(orig_row_ndx_col, Mixed(int64_t(row_ndx)));
-            if (oid_column) {
-                obj_key = oid_column->get(row_ndx);
-            }
-            else {
-                // Generate key from pk value
-                GlobalKey object_id{pk_val};
-                obj_key = global_to_local_object_id_hashed(object_id);
-            }
+            obj_key = ObjKey(key_order[i].first);
         }
 
         if (obj_key.value > max_key_value) {
@@ -2147,6 +2180,37 @@ ConstTableView Table::get_distinct_view(ColKey col_key) const
     return const_cast<Table*>(this)->get_distinct_view(col_key);
 }
 
+std::vector<std::pair<Mixed, size_t>> Table::count_distinct_values(ColKey col_key) const
+{
+    report_invalid_key(col_key);
+    if (col_key.get_attrs().test(col_attr_List) || col_key.get_type() == col_type_BackLink)
+        throw LogicError(LogicError::illegal_type);
+
+    std::vector<std::pair<Mixed, size_t>> result;
+    if (const StringIndex* index = get_search_index(col_key)) {
+        std::vector<std::pair<ObjKey, size_t>> groups;
+        index->distinct_count(groups);
+        result.reserve(groups.size());
+        for (auto& group : groups) {
+            result.emplace_back(get_object(group.first).get_any(col_key), group.second);
+        }
+        return result;
+    }
+
+    std::unordered_map<Mixed, size_t> position;
+    for (auto& obj : *this) {
+        Mixed value = obj.get_any(col_key);
+        auto it = position.emplace(value, result.size());
+        if (it.second) {
+            result.emplace_back(value, 1);
+        }
+        else {
+            result[it.first->second].second++;
+        }
+    }
+    return result;
+}
+
 TableView Table::get_sorted_view(ColKey col_key, bool ascending)
 {
     TableView tv = where().find_all();
@@ -2466,8 +2530,7 @@ Obj Table::create_object_with_primary_key(const Mixed& primary_key, bool* did_cr
         // Generate local ObjKey
         object_key = global_to_local_object_id_hashed(object_id);
         // Check for collision
-        if (is_valid(object_key)) {
-            Obj existing_obj = get_object(object_key);
+        if (Obj existing_obj = m_clusters.try_get(object_key)) {
             Mixed existing_pk_value{existing_obj.get<String>(primary_key_col)};
 
             // It may just be the same object
@@ -2489,6 +2552,29 @@ Obj Table::create_object_with_primary_key(const Mixed& primary_key, bool* did_cr
     return create_object(object_key, {{primary_key_col, primary_key}});
 }
 
+ObjKey Table::find_primary_key(Mixed primary_key) const
+{
+    auto primary_key_col = get_primary_key_column();
+    REALM_ASSERT(primary_key_col);
+    DataType type = DataType(primary_key_col.get_type());
+    REALM_ASSERT((primary_key.is_null() && primary_key_col.get_attrs().test(col_attr_Nullable)) ||
+                 primary_key.get_type() == type);
+
+    if (type == type_Int) {
+        if (primary_key.is_null())
+            return find_first_null(primary_key_col);
+        return find_first_int(primary_key_col, primary_key.get_int());
+    }
+
+    // The hashed key is only a candidate; the stored primary key decides.
+    ObjKey object_key = global_to_local_object_id_hashed(GlobalKey{primary_key});
+    if (ConstObj obj = m_clusters.try_get(object_key)) {
+        if (Mixed{obj.get<String>(primary_key_col)} == primary_key)
+            return object_key;
+    }
+    return null_key;
+}
+
 ObjKey Table::get_obj_key(GlobalKey id) const
 {
     ObjKey key;
@@ -2579,16 +2665,24 @@ ObjKey Table::global_to_local_object_id_hashed(GlobalKey object_id) const
         Array hi{alloc};
         hi.init_from_ref(to_ref(collision_map.get(s_collision_map_hi))); // Throws
 
-        // Entries are ordered by hi,lo
-        size_t found = hi.find_first(object_id.hi());
-        if (found != npos && uint64_t(hi.get(found)) == object_id.hi()) {
+        // Entries are ordered by hi,lo, so both can be found by binary search
+        size_t begin = hi.lower_bound_int(int64_t(object_id.hi()));
+        size_t end = hi.upper_bound_int(int64_t(object_id.hi()));
+        if (begin != end) {
             Array lo{alloc};
             lo.init_from_ref(to_ref(collision_map.get(s_collision_map_lo))); // Throws
-            size_t candidate = lo.find_first(object_id.lo(), found);
-            if (candidate != npos && uint64_t(hi.get(candidate)) == object_id.hi()) {
+            size_t run_end = end;
+            while (begin < end) {
+                size_t mid = begin + (end - begin) / 2;
+                if (uint64_t(lo.get(mid)) < object_id.lo())
+                    begin = mid + 1;
+                else
+                    end = mid;
+            }
+            if (begin != run_end && uint64_t(lo.get(begin)) == object_id.lo()) {
                 Array local_id{alloc};
                 local_id.init_from_ref(to_ref(collision_map.get(s_collision_map_local_id))); // Throws
-                return ObjKey{local_id.get(candidate)};
+                return ObjKey{local_id.get(begin)};
             }
         }
     }
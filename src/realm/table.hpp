@@ -279,6 +279,8 @@ public:
     // Create an object with primary key. If an object with the given primary key already exists, it
     // will be returned and did_create (if supplied) will be set to false.
     Obj create_object_with_primary_key(const Mixed& primary_key, bool* did_create = nullptr);
+    // Find the object with the given primary key. Returns null_key if no such object exists.
+    ObjKey find_primary_key(Mixed primary_key) const;
     /// Create a number of objects and add corresponding keys to a vector
     void create_objects(size_t number, std::vector<ObjKey>& keys);
     /// Create a number of objects with keys supplied
@@ -374,6 +376,8 @@ public:
 
     // Get the key of this table directly, without needing a Table accessor.
     static TableKey get_key_direct(Allocator& alloc, ref_type top_ref);
+    // Get the number of objects in this table directly, without needing a Table accessor.
+    static size_t get_size_direct(Allocator& alloc, ref_type top_ref);
 
     // Aggregate functions
     size_t count_int(ColKey col_key, int64_t value) const;
@@ -437,6 +441,13 @@ public:
     TableView get_distinct_view(ColKey col_key);
     ConstTableView get_distinct_view(ColKey col_key) const;
 
+    /// Count the objects sharing each distinct value of the column, null
+    /// included. The order of the result is unspecified. If the column has a
+    /// search index, the groups are read from it. Otherwise all objects are
+    /// visited once. String and binary values point into the Realm, just like
+    /// the result of ConstObj::get_any().
+    std::vector<std::pair<Mixed, size_t>> count_distinct_values(ColKey col_key) const;
+
     TableView get_sorted_view(ColKey col_key, bool ascending = true);
     ConstTableView get_sorted_view(ColKey col_key, bool ascending = true) const;
 
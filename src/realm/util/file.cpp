@@ -40,6 +40,11 @@
 #include <sys/file.h> // BSD / Linux flock()
 #endif
 
+#if defined(__linux__)
+#include <sys/ioctl.h>
+#include <linux/fs.h> // FICLONE
+#endif
+
 #include <realm/exceptions.hpp>
 #include <realm/util/errno.hpp>
 #include <realm/util/file_mapper.hpp>
@@ -1362,7 +1367,16 @@ void File::copy(const std::string& origin_path, const std::string& target_path)
 {
     File origin_file{origin_path, mode_Read};  // Throws
     File target_file{target_path, mode_Write}; // Throws
-    size_t buffer_size = 4096;
+
+#if defined(__linux__) && defined(FICLONE)
+    // On file systems with copy-on-write support (btrfs, XFS) the target can
+    // share all the blocks of the origin. Any failure (different file systems,
+    // no reflink support) falls back to copying the bytes.
+    if (::ioctl(target_file.m_fd, FICLONE, origin_file.m_fd) == 0)
+        return;
+#endif
+
+    size_t buffer_size = 64 * 1024;
     std::unique_ptr<char[]> buffer = std::make_unique<char[]>(buffer_size); // Throws
     for (;;) {
         size_t n = origin_file.read(buffer.get(), buffer_size); // Throws
@@ -489,6 +489,10 @@ public:
     static void move(const std::string& old_path, const std::string& new_path);
 
     /// Copy the file at the specified origin path to the specified target path.
+    ///
+    /// On Linux, this first tries to make the target a copy-on-write clone of
+    /// the origin (FICLONE). That is close to instantaneous on file systems
+    /// that support it, such as btrfs and XFS.
     static void copy(const std::string& origin_path, const std::string& target_path);
 
     /// Compare the two files at the specified paths for equality. Returns true
@@ -455,6 +455,71 @@ struct BenchmarkFindFirstStringManyDupes : BenchmarkWithStringsManyDup {
     }
 };
 
+// URL-like strings sharing a long prefix, which the string index stores under
+// deep chains of subindexes.
+struct BenchmarkWithPrefixedStrings : BenchmarkWithStringsTable {
+    void before_all(DBRef group)
+    {
+        BenchmarkWithStringsTable::before_all(group);
+        WrtTrans tr(group);
+        TableRef t = tr.get_table(name());
+
+        for (size_t i = 0; i < BASE_SIZE; ++i) {
+            std::stringstream ss;
+            ss << "https://www.example.com/some/long/path/to/resources/" << rand();
+            auto s = ss.str();
+#ifdef REALM_CLUSTER_IF
+            Obj obj = t->create_object();
+            obj.set<StringData>(m_col, s);
+            m_keys.push_back(obj.get_key());
+#else
+            auto r = t->add_empty_row();
+            t->set_string(m_col, r, s);
+#endif
+        }
+        tr.commit();
+    }
+};
+
+struct BenchmarkCreateIndexPrefixedStrings : BenchmarkWithPrefixedStrings {
+    const char* name() const
+    {
+        return "CreateIndexPrefixedStrings";
+    }
+
+    void operator()(DBRef)
+    {
+        TableRef table = m_table;
+        table->add_search_index(m_col);
+    }
+};
+
+struct BenchmarkFindFirstPrefixedStrings : BenchmarkWithPrefixedStrings {
+    const char* name() const
+    {
+        return "FindFirstPrefixedStrings";
+    }
+
+    void before_all(DBRef group)
+    {
+        BenchmarkWithPrefixedStrings::before_all(group);
+        WrtTrans tr(group);
+        tr.get_table(name())->add_search_index(m_col);
+        tr.commit();
+    }
+
+    void operator()(DBRef)
+    {
+        ConstTableRef table = m_table;
+        for (int i = 0; i < 1000; ++i) {
+            std::stringstream ss;
+            ss << "https://www.example.com/some/long/path/to/resources/" << i * 7919;
+            auto s = ss.str();
+            table->where().equal(m_col, StringData(s)).find();
+        }
+    }
+};
+
 struct BenchmarkWithLongStrings : BenchmarkWithStrings {
     void before_all(DBRef group)
     {
@@ -1541,6 +1606,43 @@ struct BenchmarkQueryInsensitiveStringIndexed : BenchmarkQueryInsensitiveString
     }
 };
 
+// Capitalized words put most index keys between the upper and lower case
+// permutations of the needle
+struct BenchmarkQueryInsensitiveCapitalizedStringIndexed : BenchmarkQueryInsensitiveString {
+    const char* name() const
+    {
+        return "QueryInsensitiveCapitalizedStringIndexed";
+    }
+    void before_all(DBRef group)
+    {
+        BenchmarkWithStringsTable::before_all(group);
+
+        static const unsigned long seed = 4;
+        seeded_rand.seed(seed);
+
+        WrtTrans tr(group);
+        TableRef t = tr.get_table(name());
+
+        for (size_t i = 0; i < BASE_SIZE; ++i) {
+            std::string str(1, char((rand() % 26) + 65));
+            size_t num_chars = 3 + rand() % 10;
+            for (size_t c = 0; c < num_chars; ++c) {
+                str += char((rand() % 26) + 97);
+            }
+#ifdef REALM_CLUSTER_IF
+            Obj obj = t->create_object();
+            obj.set<String>(m_col, str);
+            m_keys.push_back(obj.get_key());
+#else
+            auto row = t->add_empty_row();
+            t->set_string(m_col, row, str);
+#endif
+        }
+        t->add_search_index(m_col);
+        tr.commit();
+    }
+};
+
 struct BenchmarkSetLongString : BenchmarkWithLongStrings {
     const char* name() const
     {
@@ -2007,12 +2109,15 @@ int benchmark_common_tasks_main()
     BENCH(BenchmarkFindAllStringManyDupes);
     BENCH(BenchmarkFindFirstStringFewDupes);
     BENCH(BenchmarkFindFirstStringManyDupes);
+    BENCH(BenchmarkCreateIndexPrefixedStrings);
+    BENCH(BenchmarkFindFirstPrefixedStrings);
     BENCH(BenchmarkQuery);
     BENCH(BenchmarkQueryNot);
     BENCH(BenchmarkQueryLongString);
 
     BENCH(BenchmarkQueryInsensitiveString);
     BENCH(BenchmarkQueryInsensitiveStringIndexed);
+    BENCH(BenchmarkQueryInsensitiveCapitalizedStringIndexed);
     BENCH(BenchmarkQueryChainedOrStrings<false>);
     BENCH(BenchmarkQueryChainedOrStrings<true>);
     BENCH(BenchmarkQueryNotChainedOrStrings<false>);
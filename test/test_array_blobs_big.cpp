@@ -16,6 +16,9 @@
  *
  **************************************************************************/
 
+#include <algorithm>
+#include <map>
+
 #include <realm/array_blobs_big.hpp>
 #include <realm/column_integer.hpp>
 
@@ -404,3 +407,147 @@ TEST(ArrayBigBlobs_get_at)
 
     c.destroy();
 }
+
+namespace {
+
+// Allocator whose refs can be frozen, like the refs of a committed version,
+// so that copy-on-write behaviour can be observed. Refs are never reused.
+class FreezableAlloc : public Allocator {
+public:
+    FreezableAlloc()
+        : m_offset(8)
+    {
+        m_baseline = 8;
+    }
+
+    ~FreezableAlloc() noexcept
+    {
+        for (auto& entry : m_map)
+            delete[] entry.second;
+    }
+
+    // Make every ref allocated so far read-only
+    void freeze() noexcept
+    {
+        m_baseline = m_offset;
+    }
+
+    MemRef do_alloc(const size_t size) override
+    {
+        ref_type ref = m_offset;
+        char* addr = new char[size]; // Throws
+        m_map[ref] = addr;           // Throws
+        m_offset += size;
+        return MemRef(addr, ref, *this);
+    }
+
+    MemRef do_realloc(ref_type ref, char* addr, size_t old_size, size_t new_size) override
+    {
+        MemRef mem = do_alloc(new_size); // Throws
+        std::copy_n(addr, std::min(old_size, new_size), mem.get_addr());
+        do_free(ref, addr);
+        return mem;
+    }
+
+    void do_free(ref_type ref, char* addr) noexcept override
+    {
+        auto i = m_map.find(ref);
+        REALM_ASSERT(i != m_map.end());
+        REALM_ASSERT(i->second == addr);
+        m_map.erase(i);
+        delete[] addr;
+    }
+
+    char* do_translate(ref_type ref) const noexcept override
+    {
+        auto i = m_map.find(ref);
+        REALM_ASSERT(i != m_map.end());
+        return i->second;
+    }
+
+    void verify() const override
+    {
+    }
+
+private:
+    ref_type m_offset;
+    std::map<ref_type, char*> m_map;
+};
+
+} // anonymous namespace
+
+TEST(ArrayBigBlobs_SetBig)
+{
+    FreezableAlloc alloc;
+    ArrayBigBlobs c(alloc, false);
+    c.create();
+
+    std::vector<char> big_blob(0x2000000);
+    for (unsigned i = 0; i < big_blob.size(); i++) {
+        big_blob[i] = char(i & 0xFF);
+    }
+
+    auto matches = [&](size_t ndx, size_t expected_size) {
+        size_t get_pos = 0;
+        size_t idx = 0;
+        bool ok = true;
+        do {
+            BinaryData read = c.get_at(ndx, get_pos);
+            for (size_t j = 0; j < read.size(); j++) {
+                if (idx >= expected_size || read.data()[j] != big_blob[idx++])
+                    ok = false;
+            }
+        } while (get_pos);
+        return ok && idx == expected_size;
+    };
+    auto chunk_refs = [&](size_t ndx) {
+        Array root(alloc);
+        root.init_from_ref(c.get_as_ref(ndx));
+        CHECK(root.get_context_flag());
+        std::vector<ref_type> refs;
+        for (size_t i = 0; i < root.size(); i++)
+            refs.push_back(root.get_as_ref(i));
+        return refs;
+    };
+
+    c.add(BinaryData(big_blob.data(), big_blob.size()));
+    CHECK(matches(0, big_blob.size()));
+    std::vector<ref_type> refs = chunk_refs(0);
+    CHECK_EQUAL(refs.size(), 3);
+
+    // Modify a single byte in the last chunk. Once committed, only that
+    // chunk must be copied.
+    alloc.freeze();
+    big_blob[0x1fffff0] = 'x';
+    c.set(0, BinaryData(big_blob.data(), big_blob.size()));
+    CHECK(matches(0, big_blob.size()));
+    std::vector<ref_type> new_refs = chunk_refs(0);
+    CHECK_EQUAL(new_refs.size(), 3);
+    CHECK_EQUAL(new_refs[0], refs[0]);
+    CHECK_EQUAL(new_refs[1], refs[1]);
+    CHECK_NOT_EQUAL(new_refs[2], refs[2]);
+    refs = new_refs;
+
+    // Shrink to two chunks
+    alloc.freeze();
+    c.set(0, BinaryData(big_blob.data(), 0x1100000));
+    CHECK(matches(0, 0x1100000));
+    new_refs = chunk_refs(0);
+    CHECK_EQUAL(new_refs.size(), 2);
+    CHECK_EQUAL(new_refs[0], refs[0]);
+    refs = new_refs;
+
+    // Grow to three chunks again
+    alloc.freeze();
+    big_blob[0x10] = 'y';
+    c.set(0, BinaryData(big_blob.data(), big_blob.size()));
+    CHECK(matches(0, big_blob.size()));
+    new_refs = chunk_refs(0);
+    CHECK_EQUAL(new_refs.size(), 3);
+    CHECK_NOT_EQUAL(new_refs[0], refs[0]);
+#ifdef REALM_DEBUG
+    c.verify();
+#endif
+
+    c.destroy();
+}
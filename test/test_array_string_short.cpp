@@ -755,4 +755,53 @@ TEST(ArrayString_Null2)
 }
 
 
+// find_first() and find_first_prefix() compare the leading bytes of all slots
+// against a padded needle. Check them against get() for every slot width.
+TEST(ArrayString_FindFirstPrefix)
+{
+    const std::string zero(1, '\0');
+    for (size_t max_len : {1, 3, 7, 15, 31, 63}) {
+        ArrayStringShort a(Allocator::get_default(), true);
+        a.create();
+
+        std::vector<std::string> strings;
+        std::string base = "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-_";
+        for (size_t len = 0; len <= max_len; ++len) {
+            strings.push_back(base.substr(0, len));
+            if (len > 0) {
+                strings.push_back(base.substr(0, len - 1) + "X");
+                strings.push_back(base.substr(0, len - 1) + zero);
+            }
+        }
+        for (auto& str : strings)
+            a.add(str);
+        a.add(realm::null());
+
+        std::vector<StringData> needles;
+        for (auto& str : strings)
+            needles.push_back(str);
+        needles.push_back(realm::null());
+        std::string too_long = base.substr(0, max_len + 1);
+        needles.push_back(too_long);
+
+        for (StringData needle : needles) {
+            for (size_t begin : {size_t(0), size_t(2), a.size() / 2}) {
+                size_t expected_equal = not_found;
+                size_t expected_prefix = not_found;
+                for (size_t i = a.size(); i > begin; --i) {
+                    StringData str = a.get(i - 1);
+                    if (str == needle)
+                        expected_equal = i - 1;
+                    if (str.begins_with(needle))
+                        expected_prefix = i - 1;
+                }
+                CHECK_EQUAL(a.find_first(needle, begin), expected_equal);
+                CHECK_EQUAL(a.find_first_prefix(needle, begin), expected_prefix);
+            }
+        }
+
+        a.destroy();
+    }
+}
+
 #endif // TEST_ARRAY_STRING
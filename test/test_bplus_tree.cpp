@@ -431,4 +431,26 @@ TEST(BPlusTree_LeafCache)
     tree.destroy();
 }
 
+TEST(BPlusTree_SetRange)
+{
+    BPlusTree<Int> tree(Allocator::get_default());
+    tree.create();
+    const int sz = 3 * REALM_MAX_BPNODE_SIZE + 17;
+    for (int i = 0; i < sz; i++) {
+        tree.add(i);
+    }
+
+    // Overwrite a prefix ending in the middle of a leaf
+    const int n = 2 * REALM_MAX_BPNODE_SIZE + 5;
+    tree.set_range(n, [](size_t i) { return -int64_t(i); });
+    for (int i = 0; i < sz; i++) {
+        CHECK_EQUAL(tree.get(i), i < n ? -i : i);
+    }
+
+    tree.set_range(0, [](size_t) { return 7; });
+    CHECK_EQUAL(tree.get(1), -1);
+
+    tree.destroy();
+}
+
 #endif // TEST_BPLUS_TREE
@@ -863,6 +863,29 @@ TEST(Group_Serialize0)
 }
 
 
+TEST(Group_OpenReadOnlyStreamingForm)
+{
+    // The footer of a file on streaming form lives on a different page than
+    // the header once the file is large enough
+    GROUP_TEST_PATH(path);
+    ColKey col;
+    {
+        Group to_disk;
+        auto table = to_disk.add_table("test");
+        col = table->add_column(type_Int, "int");
+        for (int i = 0; i < 10000; i++)
+            table->create_object().set(col, i);
+        to_disk.write(path, crypt_key());
+    }
+    for (int i = 0; i < 2; i++) {
+        Group from_disk(path, crypt_key());
+        auto t = from_disk.get_table("test");
+        CHECK_EQUAL(t->size(), 10000);
+        CHECK_EQUAL(t->sum_int(col), 9999 * 10000 / 2);
+    }
+}
+
+
 TEST(Group_Serialize1)
 {
     GROUP_TEST_PATH(path);
@@ -1037,6 +1060,32 @@ TEST(Group_Serialize_Mem)
 }
 
 
+TEST(Group_WriteToMemLargeState)
+{
+    Group to_mem;
+    TableRef table = to_mem.add_table("test");
+    auto col_str = table->add_column(type_String, "str");
+    auto col_int = table->add_column(type_Int, "int");
+    for (int i = 0; i < 20000; i++) {
+        table->create_object().set(col_str, std::string(i % 100, 'x')).set(col_int, i);
+    }
+    // Leave most of the allocated memory free
+    for (int i = 0; i < 19000; i++) {
+        table->begin()->remove();
+    }
+
+    BinaryData buffer = to_mem.write_to_mem();
+
+    Group from_mem(buffer);
+    TableRef t = from_mem.get_table("test");
+    CHECK_EQUAL(1000, t->size());
+    CHECK(*table == *t);
+#ifdef REALM_DEBUG
+    from_mem.verify();
+#endif
+}
+
+
 TEST(Group_Close)
 {
     Group to_mem;
@@ -1356,6 +1356,47 @@ TEST_TYPES(StringIndex_InsertLongPrefix, string_column, nullable_string_column,
     col.clear(); // calls recursive function Array::destroy_deep()
 }
 
+// Strings sharing a long prefix are stored under a chain of subindexes, one
+// level per key. Cover building that chain both from a single existing object
+// and from an existing list of duplicates, and tearing it down again.
+TEST_TYPES(StringIndex_SharedPrefixChain, string_column, nullable_string_column, enum_column, nullable_enum_column)
+{
+    TEST_TYPE test_resources;
+    typename TEST_TYPE::ColumnTestType& col = test_resources.get_column();
+    const StringIndex& ndx = *col.create_search_index();
+
+    const std::string base = "https://www.example.com/some/long/path/to/resources/";
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 20; ++i)
+        strings.push_back(base + util::to_string(i * 7919));
+    // A duplicate of the first string before the others arrive turns its slot into a list
+    col.add(strings[0]);
+    col.add(strings[0]);
+    for (size_t i = 1; i < strings.size(); ++i)
+        col.add(strings[i]);
+    // Strings identical beyond the maximum key offset end up in a sorted list
+    std::string very_long_a = std::string(StringIndex::s_max_offset + 20, 'x') + "a";
+    std::string very_long_b = std::string(StringIndex::s_max_offset + 20, 'x') + "b";
+    col.add(very_long_b);
+    col.add(very_long_a);
+    ndx.verify();
+
+    CHECK_EQUAL(ndx.count(StringData(strings[0])), 2);
+    for (size_t i = 1; i < strings.size(); ++i) {
+        CHECK_EQUAL(ndx.count(StringData(strings[i])), 1);
+        CHECK_EQUAL(col.find_first(strings[i]), i + 1);
+    }
+    CHECK_EQUAL(col.find_first(very_long_a), strings.size() + 2);
+    CHECK_EQUAL(col.find_first(very_long_b), strings.size() + 1);
+    CHECK_EQUAL(ndx.count(StringData(base)), 0);
+
+    while (col.size() > 0) {
+        col.erase(col.size() - 1);
+        ndx.verify();
+    }
+    CHECK(ndx.is_empty());
+}
+
 TEST_TYPES(StringIndex_InsertLongPrefixAndQuery, string_column, nullable_string_column, enum_column,
            nullable_enum_column)
 {
@@ -1825,6 +1866,91 @@ TEST_TYPES(StringIndex_Rover, string_column, nullable_string_column, enum_column
     check_result_order(results, test_context);
 }
 
+// Case insensitive lookups seek to each case permutation of the needle in every node. Make sure that keys
+// which sort between the permutations are skipped, also when the keys are spread over several inner nodes
+// and contain bytes with the high bit set.
+TEST_TYPES(StringIndex_Insensitive_KeyRange, string_column, nullable_string_column, enum_column,
+           nullable_enum_column)
+{
+    TEST_TYPE test_resources;
+    typename TEST_TYPE::ColumnTestType& col = test_resources.get_column();
+
+    const char* prefixes[] = {"ab", "aB", "Ab", "AB", "a_", "A_", "a[", "ac", "AC", "æø", "ÆØ", "æX"};
+    const size_t num_prefixes = sizeof(prefixes) / sizeof(prefixes[0]);
+    const size_t rows = 4 * REALM_MAX_BPNODE_SIZE;
+    for (size_t i = 0; i < rows; ++i) {
+        std::string str = std::string(prefixes[i % num_prefixes]) + util::to_string(i % 50);
+        col.add(str);
+    }
+
+    const StringIndex& ndx = *col.create_search_index();
+
+    for (const char* needle : {"ab7", "AB7", "æø7", "a_7", "Ac49", "ax7"}) {
+        std::vector<ObjKey> results;
+        ndx.find_all(results, needle, true);
+        check_result_order(results, test_context);
+
+        auto needle_upper = case_map(needle, true);
+        size_t expected = 0;
+        for (size_t i = 0; i < col.size(); ++i) {
+            if (case_map(col.get(i), true) == needle_upper) {
+                ++expected;
+                CHECK(std::find(results.begin(), results.end(), col.key(i)) != results.end());
+            }
+        }
+        CHECK_EQUAL(results.size(), expected);
+    }
+}
+
+// Capitalized names put most keys between the smallest and the largest permutation of a lower case needle
+// ("A..." < "B..." < ... < "a..."). Check the lookup over many such keys, spread over several levels and
+// inner nodes.
+TEST_TYPES(StringIndex_Insensitive_CapitalizedNames, string_column, nullable_string_column, enum_column,
+           nullable_enum_column)
+{
+    TEST_TYPE test_resources;
+    typename TEST_TYPE::ColumnTestType& col = test_resources.get_column();
+
+    Random random(random_int<unsigned long>()); // Seed from slow global generator
+    const size_t rows = 8 * REALM_MAX_BPNODE_SIZE;
+    std::vector<std::string> names;
+    for (size_t i = 0; i < rows; ++i) {
+        std::string name(1, char('A' + random.draw_int_mod(26)));
+        size_t len = 2 + random.draw_int_mod(8);
+        for (size_t j = 0; j < len; ++j)
+            name += char('a' + random.draw_int_mod(3));
+        names.push_back(name);
+        col.add(StringData(name));
+    }
+    names.push_back("Alice");
+    col.add("Alice");
+    names.push_back("ALICE");
+    col.add("ALICE");
+
+    const StringIndex& ndx = *col.create_search_index();
+
+    std::vector<std::string> needles = {"alice", "aLiCe", "zzz"};
+    for (size_t i = 0; i < 20; ++i) {
+        std::string needle = *case_map(names[random.draw_int_mod(names.size())], false);
+        needles.push_back(needle);
+        needles.push_back(*case_map(needle, true));
+    }
+    for (auto& needle : needles) {
+        std::vector<ObjKey> results;
+        ndx.find_all(results, StringData(needle), true);
+        check_result_order(results, test_context);
+
+        auto needle_upper = case_map(needle, true);
+        std::vector<ObjKey> expected;
+        for (size_t i = 0; i < col.size(); ++i) {
+            if (case_map(col.get(i), true) == needle_upper)
+                expected.push_back(col.key(i));
+        }
+        std::sort(expected.begin(), expected.end());
+        CHECK(results == expected);
+    }
+}
+
 TEST(StringIndex_QuerySingleObject)
 {
     Group g;
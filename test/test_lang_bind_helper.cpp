@@ -2219,6 +2219,106 @@ TEST_TYPES(LangBindHelper_AdvanceReadTransact_TransactLog, AdvanceReadTransact,
 }
 
 
+TEST(LangBindHelper_AdvanceReadTransact_ListRemoveRange)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    std::unique_ptr<Replication> hist(make_in_realm_history(path));
+    DBRef sg = DB::create(*hist, DBOptions(crypt_key()));
+    auto tr = sg->start_read();
+
+    ColKey col;
+    std::vector<Int> values{1, 2, 3, 4, 5};
+    {
+        WriteTransaction wt(sg);
+        TableRef table = wt.add_table("table");
+        col = table->add_column_list(type_Int, "integers");
+        table->create_object().set_list_values(col, values);
+        wt.commit();
+        tr->advance_read();
+    }
+
+    struct Parser : NoOpTransactionLogParser {
+        using NoOpTransactionLogParser::NoOpTransactionLogParser;
+
+        bool list_erase(size_t ndx)
+        {
+            erased.push_back(ndx);
+            return true;
+        }
+        bool list_clear(size_t)
+        {
+            ++clears;
+            return true;
+        }
+        bool list_insert(size_t)
+        {
+            return true;
+        }
+        std::vector<size_t> erased;
+        size_t clears = 0;
+    };
+
+    // Removing every element is logged as erasures, not as a clear
+    {
+        WriteTransaction wt(sg);
+        wt.get_table("table")->begin()->get_list<Int>(col).remove(0, 5);
+        wt.commit();
+        Parser parser(test_context);
+        tr->advance_read(&parser);
+        CHECK(parser.erased == std::vector<size_t>({4, 3, 2, 1, 0}));
+        CHECK_EQUAL(parser.clears, 0);
+        CHECK_EQUAL(tr->get_table("table")->begin()->get_list<Int>(col).size(), 0);
+    }
+    {
+        WriteTransaction wt(sg);
+        wt.get_table("table")->begin()->set_list_values(col, values);
+        wt.commit();
+        tr->advance_read();
+    }
+    {
+        WriteTransaction wt(sg);
+        wt.get_table("table")->begin()->set_list_values(col, std::vector<Int>{});
+        wt.commit();
+        Parser parser(test_context);
+        tr->advance_read(&parser);
+        CHECK_EQUAL(parser.erased.size(), 5);
+        CHECK_EQUAL(parser.clears, 0);
+    }
+    // An explicit clear() is still logged as one
+    {
+        WriteTransaction wt(sg);
+        auto list = wt.get_table("table")->begin()->get_list<Int>(col);
+        list.add(1);
+        list.add(2);
+        list.clear();
+        wt.commit();
+        Parser parser(test_context);
+        tr->advance_read(&parser);
+        CHECK_EQUAL(parser.erased.size(), 0);
+        CHECK_EQUAL(parser.clears, 1);
+    }
+    // A range reaching past the end throws before anything is logged
+    {
+        WriteTransaction wt(sg);
+        wt.get_table("table")->begin()->set_list_values(col, values);
+        wt.commit();
+        tr->advance_read();
+    }
+    {
+        WriteTransaction wt(sg);
+        auto list = wt.get_table("table")->begin()->get_list<Int>(col);
+        CHECK_THROW(list.remove(2, 6), std::out_of_range);
+        CHECK_THROW(list.remove(0, 6), std::out_of_range);
+        CHECK_EQUAL(list.size(), 5);
+        wt.commit();
+        Parser parser(test_context);
+        tr->advance_read(&parser);
+        CHECK_EQUAL(parser.erased.size(), 0);
+        CHECK_EQUAL(parser.clears, 0);
+        CHECK(tr->get_table("table")->begin()->get_list_values<Int>(col) == values);
+    }
+}
+
 TEST(LangBindHelper_AdvanceReadTransact_ErrorInObserver)
 {
     SHARED_GROUP_TEST_PATH(path);
@@ -1468,6 +1468,104 @@ TEST(Links_CascadeRemove_ColumnLinkList)
 }
 
 
+TEST(Links_CascadeRemove_MultipleTables)
+{
+    // Cascades spanning several tables must reach every object, no matter
+    // in which order the pending deletions were collected
+    Group group;
+    TableRef origin = group.add_table("origin");
+    TableRef middle = group.add_table("middle");
+    TableRef leaf = group.add_table("leaf");
+    TableRef observer = group.add_table("observer");
+    auto col_list = origin->add_column_link(type_LinkList, "middles", *middle, link_Strong);
+    auto col_leaf = middle->add_column_link(type_Link, "leaf", *leaf, link_Strong);
+    auto col_weak = observer->add_column_link(type_Link, "leaf", *leaf);
+
+    const size_t num_origins = 10;
+    const size_t fan_out = 50;
+    std::vector<ObjKey> leaf_keys;
+    for (size_t i = 0; i < num_origins; ++i) {
+        auto list = origin->create_object().get_linklist(col_list);
+        for (size_t j = 0; j < fan_out; ++j) {
+            // Link the middle objects in reverse key order to shuffle the cascade
+            auto mid = middle->create_object(ObjKey(int64_t(num_origins * fan_out - i * fan_out - j)));
+            auto l = leaf->create_object();
+            mid.set(col_leaf, l.get_key());
+            list.add(mid.get_key());
+            leaf_keys.push_back(l.get_key());
+        }
+    }
+    for (auto k : leaf_keys)
+        observer->create_object().set(col_weak, k);
+
+    CHECK_EQUAL(num_origins * fan_out, middle->size());
+    CHECK_EQUAL(num_origins * fan_out, leaf->size());
+
+    origin->begin()->remove();
+    CHECK_EQUAL((num_origins - 1) * fan_out, middle->size());
+    CHECK_EQUAL((num_origins - 1) * fan_out, leaf->size());
+    group.verify();
+
+    origin->clear();
+    CHECK_EQUAL(0, middle->size());
+    CHECK_EQUAL(0, leaf->size());
+    for (auto& o : *observer)
+        CHECK_NOT(o.get<ObjKey>(col_weak));
+    group.verify();
+}
+
+
+TEST(Links_LinkList_RemoveRepeatedBacklinks)
+{
+    Group group;
+    TableRef origin = group.add_table("origin");
+    TableRef target = group.add_table("target");
+    auto col_link = origin->add_column_link(type_LinkList, "links", *target, link_Strong);
+    auto col_weak = origin->add_column_link(type_LinkList, "weak", *target);
+
+    Obj t0 = target->create_object();
+    Obj t1 = target->create_object();
+    Obj t2 = target->create_object();
+    Obj o0 = origin->create_object();
+    Obj o1 = origin->create_object();
+    Obj o2 = origin->create_object();
+
+    auto l0 = o0.get_linklist(col_link);
+    auto l1 = o1.get_linklist(col_link);
+    for (int i = 0; i < 100; ++i) {
+        l0.add(t0.get_key());
+        l1.add(t0.get_key());
+        if (i % 10 == 0)
+            l0.add(t1.get_key());
+    }
+    l1.add(t1.get_key());
+    o2.get_linklist(col_weak).add(t2.get_key());
+    l0.add(t2.get_key());
+    l0.add(t2.get_key());
+    CHECK_EQUAL(200, t0.get_backlink_count(*origin, col_link));
+    CHECK_EQUAL(11, t1.get_backlink_count(*origin, col_link));
+
+    // Remaining backlinks are kept when an origin with repeated links goes away
+    o0.remove();
+    CHECK_EQUAL(100, t0.get_backlink_count(*origin, col_link));
+    CHECK_EQUAL(1, t1.get_backlink_count(*origin, col_link));
+    CHECK_EQUAL(o1.get_key(), t1.get_backlink(*origin, col_link, 0));
+    for (size_t i = 0; i < 100; ++i)
+        CHECK_EQUAL(o1.get_key(), t0.get_backlink(*origin, col_link, i));
+    // Weak links do not keep t2 alive
+    CHECK_NOT(t2.is_valid());
+    CHECK_EQUAL(0, o2.get_linklist(col_weak).size());
+    group.verify();
+
+    // Removing the last strong links cascades to the targets
+    o1.remove();
+    CHECK_NOT(t0.is_valid());
+    CHECK_NOT(t1.is_valid());
+    CHECK_EQUAL(0, target->size());
+    group.verify();
+}
+
+
 TEST(Links_LinkList_Swap)
 {
     struct Fixture {
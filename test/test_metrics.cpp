@@ -837,6 +837,51 @@ TEST(Metrics_TransactionData)
     CHECK_EQUAL(transactions->at(2).get_total_objects(), 11 + 3 + 7);
 }
 
+TEST(Metrics_TotalObjectsWithoutTableAccessors)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    std::unique_ptr<Replication> hist(make_in_realm_history(path));
+    DBOptions options(crypt_key());
+    options.enable_metrics = true;
+    DBRef sg = DB::create(*hist, options);
+    {
+        // An empty table, a single leaf cluster, and a tree with inner nodes
+        auto wt = sg->start_write();
+        wt->add_table("empty");
+        std::vector<ObjKey> keys;
+        wt->add_table("small")->create_objects(5, keys);
+        auto big = wt->add_table("big");
+        big->add_column(type_Int, "int");
+        big->create_objects(5000, keys);
+        wt->commit();
+    }
+    sg->close();
+    sg = nullptr;
+
+    // Reopen the file, so that no table accessors exist when the metrics
+    // are gathered for the first transaction
+    hist = make_in_realm_history(path);
+    sg = DB::create(*hist, options);
+    {
+        ReadTransaction rt(sg);
+    }
+    size_t expected = 0;
+    {
+        ReadTransaction rt(sg);
+        for (auto key : rt.get_group().get_table_keys())
+            expected += rt.get_group().get_table(key)->size();
+    }
+    CHECK_EQUAL(expected, 5005);
+
+    std::shared_ptr<Metrics> metrics = sg->get_metrics();
+    CHECK(metrics);
+    std::unique_ptr<Metrics::TransactionInfoList> transactions = metrics->take_transactions();
+    CHECK(transactions);
+    CHECK_EQUAL(transactions->size(), 2);
+    CHECK_EQUAL(transactions->at(0).get_total_objects(), expected);
+    CHECK_EQUAL(transactions->at(1).get_total_objects(), expected);
+}
+
 TEST(Metrics_TransactionVersions)
 {
     SHARED_GROUP_TEST_PATH(path);
@@ -1797,6 +1797,42 @@ TEST(Query_ListOfPrimitives)
     CHECK_EQUAL(tv.size(), 1);
 }
 
+TEST(Query_ListOfPrimitivesMultipleLeaves)
+{
+    Group g;
+    TableRef table = g.add_table("foo");
+    auto col_int_list = table->add_column_list(type_Int, "integers");
+    auto col_double_list = table->add_column_list(type_Double, "doubles");
+
+    // Lists large enough to need an inner B+tree node
+    const Int list_size = REALM_MAX_BPNODE_SIZE * 3 + 17;
+    for (Int i = 0; i < 3; ++i) {
+        Obj obj = table->create_object();
+        auto ints = obj.get_list<Int>(col_int_list);
+        auto doubles = obj.get_list<Double>(col_double_list);
+        for (Int j = 0; j < list_size; ++j) {
+            ints.add(i * list_size + j);
+            doubles.add(double(j) / 2);
+        }
+    }
+
+    auto ints = table->column<Lst<Int>>(col_int_list);
+    auto doubles = table->column<Lst<Double>>(col_double_list);
+    Query q = ints == list_size * 2 - 1;
+    CHECK_EQUAL(q.count(), 1);
+    q = ints > list_size - 1;
+    CHECK_EQUAL(q.count(), 2);
+    q = ints.max() == list_size * 3 - 1;
+    CHECK_EQUAL(q.count(), 1);
+    q = ints.min() == list_size;
+    CHECK_EQUAL(q.count(), 1);
+    q = ints.sum() == list_size * (list_size - 1) / 2;
+    CHECK_EQUAL(q.count(), 1);
+    q = doubles.max() == double(list_size - 1) / 2;
+    CHECK_EQUAL(q.count(), 3);
+}
+
+
 TEST_TYPES(Query_StringIndexCommonPrefix, std::true_type, std::false_type)
 {
     Group group;
@@ -2501,6 +2537,60 @@ TEST(Query_StrEnum)
     }
 }
 
+// String conditions scan the leaf through a loop specialised for each leaf
+// representation. Check them against short, medium and big string leaves, and
+// against the same values after enumerating the column.
+TEST(Query_StringConditionsAllLeafTypes)
+{
+    for (size_t pad : {0, 20, 80}) {
+        Table table;
+        auto col = table.add_column(type_String, "str", true);
+        std::vector<std::string> values;
+        for (size_t i = 0; i < REALM_MAX_BPNODE_SIZE * 2 + 5; ++i) {
+            std::string value = (i % 3 ? "foo" : "Bar") + std::string(pad, '-') + util::to_string(i % 30);
+            values.push_back(value);
+            table.create_object().set(col, StringData(values.back()));
+        }
+        table.create_object().set(col, StringData());
+
+        auto count_if = [&](auto pred) {
+            return size_t(std::count_if(values.begin(), values.end(), pred));
+        };
+        auto check_all = [&] {
+            CHECK_EQUAL(table.where().begins_with(col, "foo").count(),
+                        count_if([](const std::string& v) { return v.compare(0, 3, "foo") == 0; }));
+            CHECK_EQUAL(table.where().begins_with(col, "bar", false).count(),
+                        count_if([](const std::string& v) { return v.compare(0, 3, "Bar") == 0; }));
+            CHECK_EQUAL(table.where().ends_with(col, "7").count(),
+                        count_if([](const std::string& v) { return v.back() == '7'; }));
+            CHECK_EQUAL(table.where().contains(col, "o-").count(),
+                        count_if([](const std::string& v) { return v.find("o-") != std::string::npos; }));
+            CHECK_EQUAL(table.where().contains(col, "R", false).count(),
+                        count_if([](const std::string& v) { return v.find('r') != std::string::npos; }));
+            CHECK_EQUAL(table.where().like(col, "foo*1").count(),
+                        count_if([](const std::string& v) { return v[0] == 'f' && v.back() == '1'; }));
+            std::string needle = "bar" + std::string(pad, '-') + "3";
+            CHECK_EQUAL(table.where().equal(col, StringData(needle), false).count(),
+                        count_if([&](const std::string& v) { return v == "Bar" + std::string(pad, '-') + "3"; }));
+
+            // Or'ed equality conditions are combined into a single node with a set of needles
+            std::vector<std::string> needles;
+            for (size_t i = 0; i < 25; ++i)
+                needles.push_back("foo" + std::string(pad, '-') + util::to_string(i));
+            Query q = table.where().equal(col, StringData(needles[0]));
+            for (size_t i = 1; i < needles.size(); ++i)
+                q.Or().equal(col, StringData(needles[i]));
+            CHECK_EQUAL(q.count(), count_if([&](const std::string& v) {
+                            return std::find(needles.begin(), needles.end(), v) != needles.end();
+                        }));
+        };
+
+        check_all();
+        table.enumerate_string_column(col);
+        check_all();
+    }
+}
+
 TEST(Query_StrIndex)
 {
     Random random(random_int<unsigned long>()); // Seed from slow global generator
@@ -3990,6 +4080,58 @@ TEST(Query_FindWithDescriptorOrderingOverTableviewSync)
     }
 }
 
+TEST(Query_DistinctFirstOccurrence)
+{
+    Table table;
+    auto col_double = table.add_column(type_Double, "double", true);
+    auto col_str = table.add_column(type_String, "str", true);
+    auto col_date = table.add_column(type_Timestamp, "date", true);
+
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<ObjKey> keys;
+    table.create_objects(8, keys);
+    table.get_object(keys[0]).set_all(0.0, "b", Timestamp(1, 1));
+    table.get_object(keys[1]).set_all(nan, "a", Timestamp(1, 0));
+    table.get_object(keys[2]).set_all(-0.0, "", Timestamp(1, 1));
+    table.get_object(keys[3]).set_all(1.5, StringData(), Timestamp(0, 1));
+    table.get_object(keys[4]).set_all(nan, "a", Timestamp());
+    table.get_object(keys[5]).set_all(1.5, "b", Timestamp(1, 0));
+    table.get_object(keys[6]).set_null(col_double).set(col_str, StringData()).set(col_date, Timestamp());
+    table.get_object(keys[7]).set_null(col_double).set(col_str, "").set(col_date, Timestamp(0, 1));
+
+    auto distinct_keys = [&](ColKey col) {
+        TableView tv = table.where().find_all();
+        tv.distinct(col);
+        std::vector<ObjKey> result;
+        for (size_t i = 0; i < tv.size(); ++i)
+            result.push_back(tv.get_key(i));
+        return result;
+    };
+
+    CHECK(distinct_keys(col_double) == std::vector<ObjKey>({keys[0], keys[1], keys[3], keys[6]}));
+    CHECK(distinct_keys(col_str) == std::vector<ObjKey>({keys[0], keys[1], keys[2], keys[3]}));
+    CHECK(distinct_keys(col_date) == std::vector<ObjKey>({keys[0], keys[1], keys[3], keys[4]}));
+
+    // Values comparing equal hash alike, and all NaNs share one hash
+    CHECK_EQUAL(Mixed(0.0).hash(), Mixed(-0.0).hash());
+    CHECK_EQUAL(Mixed(nan).hash(), Mixed(-nan).hash());
+    CHECK_EQUAL(Mixed(nan).hash(), Mixed(std::numeric_limits<double>::signaling_NaN()).hash());
+    CHECK_EQUAL(Mixed(std::nanf("1")).hash(), Mixed(std::nanf("2")).hash());
+
+    // Sorting afterwards still sees the first occurrence of each value
+    TableView tv = table.where().find_all();
+    DescriptorOrdering ordering;
+    ordering.append_distinct(DistinctDescriptor({{col_str}}));
+    ordering.append_sort(SortDescriptor({{col_double}}, {false}));
+    tv.apply_descriptor_ordering(ordering);
+    CHECK_EQUAL(tv.size(), 4);
+    CHECK_EQUAL(tv.get_key(0), keys[3]);
+    CHECK_EQUAL(tv.get_key(1), keys[0]);
+    CHECK_EQUAL(tv.get_key(2), keys[2]);
+    CHECK_EQUAL(tv.get_key(3), keys[1]);
+}
+
+
 TEST(Query_DistinctAndSort)
 {
     Group g;
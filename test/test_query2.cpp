@@ -474,6 +474,47 @@ TEST(Query_FindAllBool)
     CHECK_EQUAL(3, tv2[1].get<Int>(col_id));
 }
 
+TEST(Query_BoolEqualityWithNulls)
+{
+    Table table;
+    auto col_bool = table.add_column(type_Bool, "bool");
+    auto col_bool_null = table.add_column(type_Bool, "bool_null", true);
+
+    std::vector<util::Optional<bool>> values;
+    for (size_t i = 0; i < REALM_MAX_BPNODE_SIZE * 2 + 17; ++i) {
+        util::Optional<bool> value;
+        if (i % 7 != 3)
+            value = (i % 5 == 1 || i % 11 == 0);
+        values.push_back(value);
+        table.create_object().set(col_bool, bool(value && *value)).set(col_bool_null, value);
+    }
+
+    auto expected = [&](util::Optional<bool> needle, bool equal) {
+        return size_t(std::count_if(values.begin(), values.end(), [&](util::Optional<bool> v) {
+            return (v == needle) == equal;
+        }));
+    };
+    auto expected_non_nullable = [&](bool needle, bool equal) {
+        return size_t(std::count_if(values.begin(), values.end(), [&](util::Optional<bool> v) {
+            return (bool(v && *v) == needle) == equal;
+        }));
+    };
+
+    for (bool needle : {true, false}) {
+        CHECK_EQUAL(table.where().equal(col_bool, needle).count(), expected_non_nullable(needle, true));
+        CHECK_EQUAL(table.where().not_equal(col_bool, needle).count(), expected_non_nullable(needle, false));
+        CHECK_EQUAL(table.where().equal(col_bool_null, needle).count(), expected(needle, true));
+        CHECK_EQUAL(table.where().not_equal(col_bool_null, needle).count(), expected(needle, false));
+    }
+    CHECK_EQUAL(table.where().equal(col_bool_null, null()).count(), expected(util::none, true));
+    CHECK_EQUAL(table.where().not_equal(col_bool_null, null()).count(), expected(util::none, false));
+    CHECK_EQUAL(table.where().equal(col_bool, null()).count(), 0);
+
+    TableView tv = table.where().equal(col_bool_null, true).find_all();
+    for (size_t i = 0; i < tv.size(); ++i)
+        CHECK_EQUAL(tv.get(i).get<util::Optional<bool>>(col_bool_null), true);
+}
+
 TEST(Query_FindAllBegins)
 {
     Table table;
@@ -4095,6 +4136,99 @@ TEST(Query_TimestampCount)
     CHECK_EQUAL((timestamps != Timestamp()).count(), 9);
 }
 
+TEST(Query_TimestampBetween)
+{
+    Table table;
+    auto col_date = table.add_column(type_Timestamp, "date", true);
+    for (int i = 0; i < 2000; i++) {
+        Obj obj = table.create_object();
+        if (i % 13 == 0)
+            continue;
+        int64_t sec = i / 8 - 100;
+        int32_t nanos = (i % 8) * 100;
+        obj.set(col_date, Timestamp(sec, sec < 0 ? -nanos : nanos));
+    }
+
+    auto check_window = [&](Timestamp from, Timestamp to) {
+        size_t expected = table.where().greater_equal(col_date, from).less_equal(col_date, to).count();
+        CHECK_EQUAL(table.where().between(col_date, from, to).count(), expected);
+    };
+
+    check_window(Timestamp(0, 0), Timestamp(10, 0));
+    check_window(Timestamp(-5, -300), Timestamp(-1, -200));
+    check_window(Timestamp(-1, -500), Timestamp(1, 500));
+    check_window(Timestamp(7, 200), Timestamp(7, 400));
+    check_window(Timestamp(7, 250), Timestamp(7, 260));
+    check_window(Timestamp(20, 0), Timestamp(10, 0));
+    check_window(Timestamp(-1000, 0), Timestamp(1000, 0));
+    // Objects 858 - 860 are on the boundary second, and 858 is null
+    CHECK_EQUAL(table.where().between(col_date, Timestamp(7, 200), Timestamp(7, 400)).count(), 2);
+
+    // Null bounds behave like the pair of conditions
+    CHECK_EQUAL(table.where().between(col_date, Timestamp(), Timestamp()).count(), 154);
+
+    // A negated window
+    size_t inside = table.where().between(col_date, Timestamp(0, 0), Timestamp(10, 0)).count();
+    CHECK_EQUAL(table.where().Not().between(col_date, Timestamp(0, 0), Timestamp(10, 0)).count(),
+                table.size() - inside);
+}
+
+TEST(Query_BetweenNumeric)
+{
+    Table table;
+    auto col_int = table.add_column(type_Int, "int");
+    auto col_int_null = table.add_column(type_Int, "int_null", true);
+    auto col_float = table.add_column(type_Float, "float", true);
+    auto col_double = table.add_column(type_Double, "double");
+    for (int i = 0; i < 3000; i++) {
+        Obj obj = table.create_object();
+        int64_t v = (i * 7919) % 1000 - 500;
+        obj.set(col_int, v);
+        obj.set(col_double, v / 4.0);
+        if (i % 9 == 0) {
+            obj.set_null(col_int_null);
+            obj.set_null(col_float);
+        }
+        else {
+            obj.set(col_int_null, v);
+            obj.set(col_float, float(v) / 2);
+        }
+    }
+
+    auto check_window = [&](int64_t from, int64_t to) {
+        size_t expected = table.where().greater_equal(col_int, from).less_equal(col_int, to).count();
+        CHECK_EQUAL(table.where().between(col_int, from, to).count(), expected);
+        expected = table.where().greater_equal(col_int_null, from).less_equal(col_int_null, to).count();
+        CHECK_EQUAL(table.where().between(col_int_null, from, to).count(), expected);
+        float ffrom = float(from) / 2;
+        float fto = float(to) / 2;
+        expected = table.where().greater_equal(col_float, ffrom).less_equal(col_float, fto).count();
+        CHECK_EQUAL(table.where().between(col_float, ffrom, fto).count(), expected);
+        double dfrom = from / 4.0;
+        double dto = to / 4.0;
+        expected = table.where().greater_equal(col_double, dfrom).less_equal(col_double, dto).count();
+        CHECK_EQUAL(table.where().between(col_double, dfrom, dto).count(), expected);
+    };
+
+    check_window(0, 0);
+    check_window(-10, 10);
+    check_window(-500, -400);
+    check_window(450, 10000);
+    check_window(-100000, 100000);
+    check_window(10, -10);
+    check_window(std::numeric_limits<int64_t>::min(), 0);
+
+    // Every value occurs 3 times in the non-nullable column
+    CHECK_EQUAL(table.where().between(col_int, -10, 10).count(), 63);
+
+    // Combined with other conditions
+    Query q = table.where().between(col_int, -100, 100).equal(col_int_null, null());
+    size_t expected =
+        table.where().greater_equal(col_int, -100).less_equal(col_int, 100).equal(col_int_null, null()).count();
+    CHECK_EQUAL(q.count(), expected);
+    CHECK_EQUAL(table.where().between(col_int, 1, 1).find(), table.where().equal(col_int, 1).find());
+}
+
 TEST(Query_Timestamp_Null)
 {
     // Test that querying for null on non-nullable column (with default value being non-null value) is
@@ -41,6 +41,7 @@
 #endif
 
 #include <realm/history.hpp>
+#include <realm/group_writer.hpp>
 #include <realm.hpp>
 #include <realm/util/features.h>
 #include <realm/util/safe_int_ops.hpp>
@@ -678,6 +679,41 @@ TEST(Shared_InitialMem)
 }
 
 
+NONCONCURRENT_TEST(Shared_MemOnlyLargeCommit)
+{
+    // Commits spanning more than the 16 write windows cached by the group
+    // writer, so that windows are evicted and extended during the commit.
+    // Only Durability::Full syncs the windows when doing so.
+    auto large_commits = [&](DBOptions::Durability durability) {
+        SHARED_GROUP_TEST_PATH(path);
+        bool no_create = false;
+        DBRef sg = DB::create(path, no_create, DBOptions(durability));
+        ColKey col;
+        std::string value(1000, 'x');
+        size_t syncs_before = GroupWriter::get_num_window_syncs();
+        for (int round = 0; round < 2; ++round) {
+            WriteTransaction wt(sg);
+            auto t = round == 0 ? wt.add_table("test") : wt.get_table("test");
+            if (round == 0)
+                col = t->add_column(type_String, "str");
+            for (int i = 0; i < 20000; ++i)
+                t->create_object().set(col, value);
+            wt.commit();
+        }
+        size_t num_syncs = GroupWriter::get_num_window_syncs() - syncs_before;
+        ReadTransaction rt(sg);
+        auto t = rt.get_table("test");
+        CHECK_EQUAL(t->size(), 40000);
+        CHECK_EQUAL(t->begin()->get<String>(col), value);
+        rt.get_group().verify();
+        return num_syncs;
+    };
+
+    CHECK_EQUAL(large_commits(DBOptions::Durability::MemOnly), 0);
+    CHECK_GREATER(large_commits(DBOptions::Durability::Full), 0);
+}
+
+
 TEST(Shared_InitialMem_StaleFile)
 {
     SHARED_GROUP_TEST_PATH(path);
@@ -2940,6 +2976,151 @@ TEST(Shared_CompactEmpty)
 }
 
 
+namespace {
+
+void check_snapshot_to(TestContext& test_context, const std::string& path, const std::string& snapshot_path,
+                       DBOptions::Durability durability)
+{
+    const char* key = durability == DBOptions::Durability::Async ? nullptr : crypt_key();
+    ColKey col;
+    {
+        DBRef sg = DB::create(path, false, DBOptions(durability, key));
+        for (int i = 0; i < 3; ++i) {
+            WriteTransaction wt(sg);
+            auto t = wt.get_or_add_table("test");
+            if (!col)
+                col = t->add_column(type_Int, "int");
+            for (int j = 0; j < 1000; ++j) {
+                t->create_object().set(col, j);
+            }
+            wt.commit();
+        }
+        // An open reader must not keep the snapshot from being taken
+        ReadTransaction rt(sg);
+        sg->snapshot_to(snapshot_path);
+        {
+            WriteTransaction wt(sg);
+            wt.get_table("test")->clear();
+            wt.commit();
+        }
+    }
+
+    DBRef snapshot = DB::create(snapshot_path, false, DBOptions(key));
+    ReadTransaction rt(snapshot);
+    rt.get_group().verify();
+    auto t = rt.get_table("test");
+    CHECK(t);
+    if (!t)
+        return;
+    CHECK_EQUAL(t->size(), 3000);
+    CHECK_EQUAL(t->sum_int(col), 3 * 999 * 1000 / 2);
+}
+
+} // anonymous namespace
+
+TEST(Shared_SnapshotTo)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    SHARED_GROUP_TEST_PATH(snapshot_path);
+    check_snapshot_to(test_context, path, snapshot_path, DBOptions::Durability::Full);
+}
+
+TEST(Shared_SnapshotToUnsafe)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    SHARED_GROUP_TEST_PATH(snapshot_path);
+    check_snapshot_to(test_context, path, snapshot_path, DBOptions::Durability::Unsafe);
+}
+
+TEST(Shared_SnapshotToMemOnly)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    SHARED_GROUP_TEST_PATH(snapshot_path);
+    check_snapshot_to(test_context, path, snapshot_path, DBOptions::Durability::MemOnly);
+}
+
+#if !defined(_WIN32) && !REALM_PLATFORM_APPLE
+TEST_IF(Shared_SnapshotToAsync, allow_async)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    SHARED_GROUP_TEST_PATH(snapshot_path);
+    check_snapshot_to(test_context, path, snapshot_path, DBOptions::Durability::Async);
+}
+#endif
+
+
+TEST(Shared_SpillWriteTransaction)
+{
+    SHARED_GROUP_TEST_PATH(path);
+    std::unique_ptr<Replication> hist(make_in_realm_history(path));
+    DBRef sg = DB::create(*hist, DBOptions(crypt_key()));
+    ColKey col_int, col_str;
+    {
+        WriteTransaction wt(sg);
+        auto t = wt.add_table("test");
+        col_int = t->add_column(type_Int, "int");
+        col_str = t->add_column(type_String, "str");
+        wt.commit();
+    }
+
+    auto load = [&](Transaction& tr, int begin, int end) {
+        auto t = tr.get_table("test");
+        for (int i = begin; i < end; ++i)
+            t->create_object().set(col_int, i).set(col_str, std::string(100, 'a' + i % 26));
+    };
+
+    // Rolling back discards spilled changes
+    {
+        auto tr = sg->start_write();
+        load(*tr, 0, 1000);
+        tr->spill();
+        CHECK_EQUAL(tr->get_table("test")->size(), 1000);
+        tr->rollback();
+    }
+    {
+        auto rt = sg->start_read();
+        CHECK_EQUAL(rt->get_table("test")->size(), 0);
+    }
+
+    auto rt = sg->start_read();
+    auto tr = sg->start_write();
+    TableRef t = tr->get_table("test");
+    for (int i = 0; i < 5; ++i) {
+        load(*tr, i * 2000, (i + 1) * 2000);
+        size_t commit_size = tr->get_commit_size();
+        tr->spill();
+        CHECK_LESS(tr->get_commit_size(), commit_size);
+        // Accessors survive, and readers do not see the spilled state
+        CHECK_EQUAL(t->size(), (i + 1) * 2000);
+        CHECK_EQUAL(rt->get_table("test")->size(), 0);
+    }
+    t->begin()->remove();
+    tr->commit();
+
+    rt->advance_read();
+    auto t2 = rt->get_table("test");
+    CHECK_EQUAL(t2->size(), 9999);
+    CHECK_EQUAL(t2->sum_int(col_int), 9999 * 10000 / 2);
+    CHECK_EQUAL(t2->get_object(9998).get<String>(col_str), std::string(100, 'a' + 9999 % 26));
+    rt->verify();
+
+    // The spilled data is in the file after reopening it
+    rt = nullptr;
+    tr = nullptr;
+    sg->close();
+    sg = nullptr;
+    hist = make_in_realm_history(path);
+    sg = DB::create(*hist, DBOptions(crypt_key()));
+    rt = sg->start_read();
+    t2 = rt->get_table("test");
+    CHECK_EQUAL(t2->size(), 9999);
+    CHECK_EQUAL(t2->sum_int(col_int), 9999 * 10000 / 2);
+    CHECK_EQUAL(t2->get_object(0).get<Int>(col_int), 1);
+    CHECK_EQUAL(t2->get_object(4321).get<String>(col_str), std::string(100, 'a' + 4322 % 26));
+    rt->verify();
+}
+
+
 TEST(Shared_VersionOfBoundSnapshot)
 {
     SHARED_GROUP_TEST_PATH(path);
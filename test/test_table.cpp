@@ -1588,6 +1588,103 @@ TEST(Table_DistinctBool)
 }
 
 
+TEST(Table_CountDistinctValues)
+{
+    Table table;
+    auto col_int = table.add_column(type_Int, "int", true);
+    auto col_str = table.add_column(type_String, "str", true);
+    auto col_double = table.add_column(type_Double, "double");
+
+    const char* strings[] = {"foo", "bar", "baz", "a longer string sharing no prefix"};
+    std::map<int64_t, size_t> expected_ints;
+    std::map<std::string, size_t> expected_strings;
+    size_t null_ints = 0;
+    size_t null_strings = 0;
+    for (int i = 0; i < 300; ++i) {
+        Obj obj = table.create_object();
+        if (i % 7 == 0) {
+            null_ints++;
+        }
+        else {
+            obj.set(col_int, i % 5);
+            expected_ints[i % 5]++;
+        }
+        if (i % 11 == 0) {
+            null_strings++;
+        }
+        else {
+            obj.set(col_str, strings[i % 4]);
+            expected_strings[strings[i % 4]]++;
+        }
+        obj.set(col_double, double(i % 3));
+    }
+
+    auto check = [&] {
+        auto int_groups = table.count_distinct_values(col_int);
+        CHECK_EQUAL(int_groups.size(), expected_ints.size() + 1);
+        for (auto& group : int_groups) {
+            if (group.first.is_null())
+                CHECK_EQUAL(group.second, null_ints);
+            else
+                CHECK_EQUAL(group.second, expected_ints[group.first.get_int()]);
+        }
+        auto str_groups = table.count_distinct_values(col_str);
+        CHECK_EQUAL(str_groups.size(), expected_strings.size() + 1);
+        for (auto& group : str_groups) {
+            if (group.first.is_null())
+                CHECK_EQUAL(group.second, null_strings);
+            else
+                CHECK_EQUAL(group.second, expected_strings[group.first.get_string()]);
+        }
+    };
+
+    check();
+    table.add_search_index(col_int);
+    table.add_search_index(col_str);
+    check();
+
+    auto double_groups = table.count_distinct_values(col_double);
+    CHECK_EQUAL(double_groups.size(), 3);
+    for (auto& group : double_groups)
+        CHECK_EQUAL(group.second, 100);
+}
+
+TEST(Table_GetSizeDirect)
+{
+    Group g;
+    g.add_table("empty");
+    std::vector<ObjKey> keys;
+    g.add_table("leaf")->create_objects(5, keys);
+    keys.clear();
+    auto inner = g.add_table("inner");
+    auto col = inner->add_column(type_Int, "int");
+    inner->create_objects(5000, keys);
+    // Leave a tree with inner nodes whose children are not full
+    for (size_t i = 0; i < 5000; i += 3)
+        inner->remove_object(keys[i]);
+    inner->get_object(keys[1]).set(col, 7);
+
+    // The object count read from the cluster tree of each table must match
+    // the size reported by its accessor
+    Allocator& alloc = _impl::GroupFriend::get_alloc(g);
+    Array top(alloc);
+    top.init_from_ref(_impl::GroupFriend::get_top_ref(g));
+    Array tables(alloc);
+    tables.init_from_ref(top.get_as_ref(1));
+    size_t num_checked = 0;
+    for (size_t i = 0; i < tables.size(); ++i) {
+        RefOrTagged rot = tables.get_as_ref_or_tagged(i);
+        if (!rot.is_ref() || !rot.get_as_ref())
+            continue;
+        ref_type ref = rot.get_as_ref();
+        ConstTableRef t = g.get_table(Table::get_key_direct(alloc, ref));
+        CHECK_EQUAL(Table::get_size_direct(alloc, ref), t->size());
+        ++num_checked;
+    }
+    CHECK_EQUAL(num_checked, 3);
+    CHECK_EQUAL(inner->size(), 3333);
+}
+
 /*
 // FIXME Commented out because indexes on floats and doubles are not supported (yet).
 
@@ -2292,6 +2389,45 @@ TEST(Table_AddColumnWithThreeLevelBptree)
     table.verify();
 }
 
+TEST(Table_AddColumnDefaultValues)
+{
+    Group g;
+    Table& table = *g.add_table("origin");
+    Table& target = *g.add_table("target");
+    std::vector<ObjKey> keys;
+    table.add_column(type_Int, "int0");
+    table.create_objects(1000, keys);
+
+    auto col_int = table.add_column(type_Int, "int");
+    auto col_int_null = table.add_column(type_Int, "int_null", true);
+    auto col_bool_null = table.add_column(type_Bool, "bool_null", true);
+    auto col_float = table.add_column(type_Float, "float");
+    auto col_float_null = table.add_column(type_Float, "float_null", true);
+    auto col_double = table.add_column(type_Double, "double");
+    auto col_double_null = table.add_column(type_Double, "double_null", true);
+    auto col_link = table.add_column_link(type_Link, "link", target);
+    table.verify();
+
+    for (auto obj : table) {
+        CHECK_EQUAL(obj.get<Int>(col_int), 0);
+        CHECK(obj.is_null(col_int_null));
+        CHECK(obj.is_null(col_bool_null));
+        CHECK_EQUAL(obj.get<float>(col_float), 0.f);
+        CHECK(obj.is_null(col_float_null));
+        CHECK_EQUAL(obj.get<double>(col_double), 0.);
+        CHECK(obj.is_null(col_double_null));
+        CHECK(obj.is_null(col_link));
+    }
+
+    Obj obj = table.get_object(keys[500]);
+    obj.set(col_int_null, 7);
+    obj.set(col_link, target.create_object().get_key());
+    CHECK_EQUAL(obj.get<util::Optional<Int>>(col_int_null), 7);
+    CHECK(table.get_object(keys[499]).is_null(col_int_null));
+    CHECK(table.get_object(keys[501]).is_null(col_link));
+    CHECK_EQUAL(target.begin()->get_backlink_count(), 1);
+}
+
 TEST(Table_DeleteObjectsInFirstCluster)
 {
     // Designed to exercise logic if cluster size is 4
@@ -3118,6 +3254,44 @@ TEST(Table_ListOps)
     CHECK_EQUAL(list2.size(), 3);
 }
 
+TEST(Table_ListRemoveRange)
+{
+    Table table;
+    ColKey col = table.add_column_list(type_Int, "integers");
+    Obj obj = table.create_object();
+
+    std::vector<Int> values;
+    for (Int i = 0; i < 500; ++i)
+        values.push_back(i);
+    obj.set_list_values(col, values);
+    auto list = obj.get_list<Int>(col);
+    CHECK_EQUAL(list.size(), 500);
+
+    list.remove(100, 400);
+    CHECK_EQUAL(list.size(), 200);
+    CHECK_EQUAL(list.get(99), 99);
+    CHECK_EQUAL(list.get(100), 400);
+    list.remove(5, 5);
+    CHECK_EQUAL(list.size(), 200);
+    CHECK_THROW(list.remove(150, 201), std::out_of_range);
+    CHECK_THROW(list.remove(0, 201), std::out_of_range);
+    CHECK_EQUAL(list.size(), 200);
+    CHECK_EQUAL(list.get(199), 499);
+
+    // Shrinking and growing through set_list_values
+    obj.set_list_values(col, std::vector<Int>{7, 8, 9});
+    CHECK(obj.get_list_values<Int>(col) == (std::vector<Int>{7, 8, 9}));
+    obj.set_list_values(col, values);
+    CHECK(obj.get_list_values<Int>(col) == values);
+
+    list.resize(10);
+    CHECK_EQUAL(list.size(), 10);
+    CHECK_EQUAL(list.get(9), 9);
+    list.remove(0, list.size());
+    CHECK_EQUAL(list.size(), 0);
+    table.verify();
+}
+
 TEST(Table_ListOfPrimitives)
 {
     Group g;
@@ -4017,6 +4191,24 @@ TEST(Table_CreateObjectWithPrimaryKeyDidCreate)
     CHECK_NOT(did_create);
 }
 
+TEST(Table_FindPrimaryKey)
+{
+    Group g;
+    TableRef string_table = g.add_table_with_primary_key("string pk", type_String, "pk", true);
+    auto k1 = string_table->create_object_with_primary_key(StringData("Adam")).get_key();
+    auto k2 = string_table->create_object_with_primary_key(StringData()).get_key();
+    CHECK_EQUAL(string_table->find_primary_key(StringData("Adam")), k1);
+    CHECK_EQUAL(string_table->find_primary_key(StringData()), k2);
+    CHECK_NOT(string_table->find_primary_key(StringData("Eva")));
+
+    TableRef int_table = g.add_table_with_primary_key("int pk", type_Int, "pk", true);
+    auto k3 = int_table->create_object_with_primary_key(5).get_key();
+    auto k4 = int_table->create_object_with_primary_key(util::Optional<int64_t>()).get_key();
+    CHECK_EQUAL(int_table->find_primary_key(5), k3);
+    CHECK_EQUAL(int_table->find_primary_key(util::Optional<int64_t>()), k4);
+    CHECK_NOT(int_table->find_primary_key(7));
+}
+
 TEST(Table_PrimaryKeyString)
 {
 #ifdef REALM_DEBUG
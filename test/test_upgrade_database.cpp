@@ -1289,6 +1289,25 @@ TEST(Upgrade_Database_9_10_with_pk_table)
 
     pk_col = t_dog->get_primary_key_column();
     CHECK(pk_col);
+
+    // Each object can be found by its primary key and holds the values of
+    // its old row
+    pk_col = t_object->get_primary_key_column();
+    auto col_value = t_object->get_column_key("value");
+    auto col_optional = t_object->get_column_key("optional");
+    std::map<std::string, std::pair<int64_t, util::Optional<int64_t>>> expected = {
+        {"hello", {7, util::none}}, {"world", {35, util::none}}, {"goodbye", {800, -87}}};
+    CHECK_EQUAL(t_object->size(), expected.size());
+    for (auto&& obj : *t_object) {
+        std::string pk = obj.get<String>(pk_col);
+        CHECK_EQUAL(t_object->find_first_string(pk_col, pk), obj.get_key());
+        auto it = expected.find(pk);
+        CHECK(it != expected.end());
+        if (it == expected.end())
+            continue;
+        CHECK_EQUAL(obj.get<Int>(col_value), it->second.first);
+        CHECK(obj.get<util::Optional<Int>>(col_optional) == it->second.second);
+    }
 }
 
 TEST(Upgrade_Database_9_10_with_oid)
@@ -1350,6 +1369,37 @@ TEST(Upgrade_Database_9_10_with_oid)
     CHECK_EQUAL(ll.get_object(0).get<String>("name"), "Tom");
     CHECK_EQUAL(ll.get_object(1).get<String>("name"), "Jerry");
 
+    // Check that every object got the key of its old !OID value, together
+    // with its own values
+    struct Expected {
+        int64_t key;
+        const char* ident;
+        int64_t value;
+        util::Optional<int64_t> optional;
+    };
+    std::vector<Expected> expected = {{717911018529132092, "goodbye", 800, -87},
+                                      {2515477941069477034, "hello", 7, util::none},
+                                      {6444968757765087612, "world", 35, util::none}};
+    CHECK_EQUAL(t_bar->size(), expected.size());
+    auto col_ident = t_bar->get_column_key("ident");
+    auto col_value = t_bar->get_column_key("value");
+    auto col_optional = t_bar->get_column_key("optional");
+    for (auto& e : expected) {
+        ObjKey key(e.key);
+        CHECK(t_bar->is_valid(key));
+        if (!t_bar->is_valid(key))
+            continue;
+        auto obj = t_bar->get_object(key);
+        CHECK_EQUAL(obj.get<String>(col_ident), e.ident);
+        CHECK_EQUAL(obj.get<Int>(col_value), e.value);
+        CHECK(obj.get<util::Optional<Int>>(col_optional) == e.optional);
+    }
+    ConstTableRef t_foo = rt.get_table("class_foo");
+    auto col_name = t_foo->get_column_key("name");
+    CHECK_EQUAL(t_foo->get_object(ObjKey(512)).get<String>(col_name), "Tom");
+    CHECK_EQUAL(t_foo->get_object(ObjKey(513)).get<String>(col_name), "Pluto");
+    CHECK_EQUAL(t_foo->get_object(ObjKey(514)).get<String>(col_name), "Jerry");
+
     // Check that the objects can be found by primary key
     pk_col = t_bar->get_primary_key_column();
     for (auto&& obj : *t_bar) {